@@ -0,0 +1,141 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS. If not, see <https://www.gnu.org/licenses/>.
+
+  @file BLSConcurrentSigShareSet.cpp
+  @author SKALE Labs
+  @date 2026
+*/
+
+#include <bls/BLSConcurrentSigShareSet.h>
+#include <bls/BLSPublicKeyShare.h>
+#include <bls/BLSSigShare.h>
+#include <bls/BLSSigShareSet.h>
+#include <bls/BLSSignature.h>
+#include <tools/utils.h>
+
+
+BLSConcurrentSigShareSet::BLSConcurrentSigShareSet(
+    size_t _requiredSigners, size_t _totalSigners, MergeCallback _onMerged )
+    : BLSConcurrentSigShareSet( _requiredSigners, _totalSigners, nullptr, nullptr, _onMerged ) {}
+
+BLSConcurrentSigShareSet::BLSConcurrentSigShareSet( size_t _requiredSigners,
+    size_t _totalSigners, std::shared_ptr< std::array< uint8_t, 32 > > _hash_ptr,
+    std::shared_ptr< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > > _publicKeyShares,
+    MergeCallback _onMerged )
+    : requiredSigners( _requiredSigners ),
+      totalSigners( _totalSigners ),
+      hash_ptr( _hash_ptr ),
+      publicKeyShares( _publicKeyShares ),
+      onMerged( _onMerged ),
+      sigShares( _totalSigners ),
+      sigSharesCount( 0 ),
+      signature( signaturePromise.get_future().share() ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    if ( hash_ptr && !publicKeyShares ) {
+        throw libBLS::ThresholdUtils::IncorrectInput( "public key shares are null" );
+    }
+
+    // libff profiling is switched off by LibBLSContext, shares are verified on the threads
+    // adding them
+    libBLS::ThresholdUtils::initCurve();
+}
+
+bool BLSConcurrentSigShareSet::addSigShare( std::shared_ptr< BLSSigShare > _sigShare ) {
+    CHECK( _sigShare );
+
+    size_t index = _sigShare->getSignerIndex();
+    if ( index == 0 || index > totalSigners ) {
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Index out of range:" + std::to_string( index ) );
+    }
+
+    if ( hash_ptr ) {
+        auto publicKeyShare = publicKeyShares->find( index );
+        if ( publicKeyShare == publicKeyShares->end() || !publicKeyShare->second ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "No public key share for signer:" + std::to_string( index ) );
+        }
+
+        if ( !publicKeyShare->second->VerifySig(
+                 hash_ptr, _sigShare, requiredSigners, totalSigners ) ) {
+            return false;
+        }
+    }
+
+    std::shared_ptr< BLSSigShare > empty;
+    if ( !std::atomic_compare_exchange_strong( &sigShares[index - 1], &empty, _sigShare ) ) {
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Already have this index:" + std::to_string( index ) );
+    }
+
+    // the share is stored before it is counted, so the merging thread sees at least t shares
+    if ( sigSharesCount.fetch_add( 1 ) + 1 == requiredSigners ) {
+        merge();
+    }
+
+    return true;
+}
+
+void BLSConcurrentSigShareSet::merge() {
+    std::shared_ptr< BLSSignature > sig;
+
+    try {
+        BLSSigShareSet sigSet( requiredSigners, totalSigners );
+        for ( size_t i = 0; i < totalSigners && !sigSet.isEnough(); ++i ) {
+            auto sigShare = std::atomic_load( &sigShares[i] );
+            if ( sigShare ) {
+                sigSet.addSigShare( sigShare );
+            }
+        }
+
+        sig = sigSet.merge();
+    } catch ( ... ) {
+        signaturePromise.set_exception( std::current_exception() );
+        return;
+    }
+
+    signaturePromise.set_value( sig );
+
+    if ( onMerged ) {
+        onMerged( sig );
+    }
+}
+
+bool BLSConcurrentSigShareSet::isEnough() const {
+    return sigSharesCount >= requiredSigners;
+}
+
+size_t BLSConcurrentSigShareSet::getTotalSigSharesCount() const {
+    return sigSharesCount;
+}
+
+std::shared_ptr< BLSSigShare > BLSConcurrentSigShareSet::getSigShareByIndex(
+    size_t _index ) const {
+    if ( _index == 0 || _index > totalSigners ) {
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Index out of range:" + std::to_string( _index ) );
+    }
+
+    return std::atomic_load( &sigShares[_index - 1] );
+}
+
+std::shared_future< std::shared_ptr< BLSSignature > > BLSConcurrentSigShareSet::getSignature()
+    const {
+    return signature;
+}
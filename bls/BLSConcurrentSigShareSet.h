@@ -0,0 +1,88 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+  @file BLSConcurrentSigShareSet.h
+  @author SKALE Labs
+  @date 2026
+*/
+
+#ifndef LIBBLS_BLSCONCURRENTSIGSHARESET_H
+#define LIBBLS_BLSCONCURRENTSIGSHARESET_H
+
+#include <atomic>
+#include <functional>
+#include <future>
+#include <map>
+
+#include <bls/bls.h>
+class BLSSignature;
+class BLSSigShare;
+class BLSPublicKeyShare;
+
+// set of signature shares that may be filled from several threads at once, the thread adding
+// the share that makes the set enough merges it exactly once and completes getSignature()
+class BLSConcurrentSigShareSet {
+public:
+    typedef std::function< void( std::shared_ptr< BLSSignature > ) > MergeCallback;
+
+private:
+    size_t requiredSigners;
+    size_t totalSigners;
+
+    // shares are verified before they are counted if the hash is set
+    std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr;
+    std::shared_ptr< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > > publicKeyShares;
+
+    MergeCallback onMerged;
+
+    // share of signer i is at i - 1, slots are only accessed with atomic shared_ptr functions
+    std::vector< std::shared_ptr< BLSSigShare > > sigShares;
+
+    std::atomic< size_t > sigSharesCount;
+
+    std::promise< std::shared_ptr< BLSSignature > > signaturePromise;
+    std::shared_future< std::shared_ptr< BLSSignature > > signature;
+
+    void merge();
+
+public:
+    BLSConcurrentSigShareSet(
+        size_t requiredSigners, size_t totalSigners, MergeCallback onMerged = nullptr );
+
+    BLSConcurrentSigShareSet( size_t requiredSigners, size_t totalSigners,
+        std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
+        std::shared_ptr< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >
+            publicKeyShares,
+        MergeCallback onMerged = nullptr );
+
+    // returns false if the share does not pass verification, shares added after the merge are
+    // kept but do not change the signature
+    bool addSigShare( std::shared_ptr< BLSSigShare > _sigShare );
+
+    bool isEnough() const;
+
+    size_t getTotalSigSharesCount() const;
+
+    std::shared_ptr< BLSSigShare > getSigShareByIndex( size_t _index ) const;
+
+    // becomes ready when the set is merged, holds the exception if the merge failed
+    std::shared_future< std::shared_ptr< BLSSignature > > getSignature() const;
+};
+
+
+#endif  // LIBBLS_BLSCONCURRENTSIGSHARESET_H
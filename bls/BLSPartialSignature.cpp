@@ -0,0 +1,308 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS. If not, see <https://www.gnu.org/licenses/>.
+
+  @file BLSPartialSignature.cpp
+  @author SKALE Labs
+  @date 2026
+*/
+
+#include <algorithm>
+
+#include <bls/BLSPartialSignature.h>
+#include <bls/BLSSigShare.h>
+#include <bls/BLSSignature.h>
+#include <tools/utils.h>
+
+namespace {
+
+// t and n are 32 bit big endian numbers in front of the point, the hint and the two bitmaps
+constexpr size_t SIGNERS_COUNT_BYTES = 4;
+constexpr size_t PARTIAL_HEADER_BYTES = 2 * SIGNERS_COUNT_BYTES + BLS_G1_BYTES + BLS_HINT_BYTES;
+
+void SignersCountToBytes( size_t count, uint8_t* bytes ) {
+    if ( count >> ( 8 * SIGNERS_COUNT_BYTES ) != 0 ) {
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Number of signers does not fit into 32 bits" );
+    }
+    for ( size_t i = 0; i < SIGNERS_COUNT_BYTES; ++i ) {
+        bytes[SIGNERS_COUNT_BYTES - 1 - i] = uint8_t( count >> ( 8 * i ) );
+    }
+}
+
+size_t SignersCountFromBytes( const uint8_t* bytes ) {
+    size_t count = 0;
+    for ( size_t i = 0; i < SIGNERS_COUNT_BYTES; ++i ) {
+        count = ( count << 8 ) | bytes[i];
+    }
+    return count;
+}
+
+void BitmapToBytes( const std::vector< bool >& bitmap, uint8_t* bytes ) {
+    for ( size_t i = 0; i < bitmap.size(); ++i ) {
+        if ( bitmap[i] ) {
+            bytes[i / 8] |= uint8_t( 1 << ( i % 8 ) );
+        }
+    }
+}
+
+std::vector< bool > BitmapFromBytes( const uint8_t* bytes, size_t size ) {
+    std::vector< bool > bitmap( size );
+    for ( size_t i = 0; i < size; ++i ) {
+        bitmap[i] = ( bytes[i / 8] >> ( i % 8 ) ) & 1;
+    }
+
+    // bits past the last signer should be zero, so that the encoding is unique
+    if ( size % 8 != 0 && ( bytes[size / 8] >> ( size % 8 ) ) != 0 ) {
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong padding of signers bitmap" );
+    }
+
+    return bitmap;
+}
+
+}  // namespace
+
+BLSPartialSignature::BLSPartialSignature( const std::vector< size_t >& finalSigners,
+    const std::vector< std::shared_ptr< BLSSigShare > >& sigShares, size_t _requiredSigners,
+    size_t _totalSigners )
+    : signerSet( _totalSigners ),
+      signers( _totalSigners ),
+      requiredSigners( _requiredSigners ),
+      totalSigners( _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    libBLS::ThresholdUtils::initCurve();
+
+    if ( finalSigners.size() != requiredSigners ) {
+        throw libBLS::ThresholdUtils::IncorrectInput( "Final signer set should have t signers" );
+    }
+
+    for ( size_t index : finalSigners ) {
+        if ( index == 0 || index > totalSigners || signerSet[index - 1] ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "Wrong index in final signer set:" + std::to_string( index ) );
+        }
+        signerSet[index - 1] = true;
+    }
+
+    if ( sigShares.empty() ) {
+        throw libBLS::ThresholdUtils::IncorrectInput( "No shares to create partial signature" );
+    }
+
+    // coefficients of the final set in the ascending order of indexes
+    std::vector< size_t > sortedSigners( finalSigners );
+    std::sort( sortedSigners.begin(), sortedSigners.end() );
+    std::vector< libff::alt_bn128_Fr > lagrangeCoeffs =
+        libBLS::LagrangeCoeffsCache::getInstance().get( sortedSigners, requiredSigners );
+
+    std::vector< libff::alt_bn128_Fr > coeffs;
+    std::vector< libff::alt_bn128_G1 > shares;
+
+    for ( auto&& sigShare : sigShares ) {
+        CHECK( sigShare );
+
+        size_t index = sigShare->getSignerIndex();
+        if ( index == 0 || index > totalSigners || !signerSet[index - 1] ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "Signer is not in final signer set:" + std::to_string( index ) );
+        }
+        if ( signers[index - 1] ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "Already have this index:" + std::to_string( index ) );
+        }
+        if ( !sigShare->getSigShare()->is_well_formed() ) {
+            throw libBLS::ThresholdUtils::IsNotWellFormed(
+                "incorrect input data to recover signature" );
+        }
+        signers[index - 1] = true;
+
+        size_t position =
+            std::lower_bound( sortedSigners.begin(), sortedSigners.end(), index ) -
+            sortedSigners.begin();
+        coeffs.push_back( lagrangeCoeffs[position] );
+        shares.push_back( *sigShare->getSigShare() );
+    }
+
+    sig = std::make_shared< libff::alt_bn128_G1 >(
+        libBLS::ThresholdUtils::MultiScalarMul( coeffs, shares ) );
+
+    hint = sigShares.at( 0 )->getHint();
+}
+
+BLSPartialSignature::BLSPartialSignature( const std::shared_ptr< libff::alt_bn128_G1 > _sig,
+    std::string& _hint, const std::vector< bool >& _signerSet, const std::vector< bool >& _signers,
+    size_t _requiredSigners, size_t _totalSigners )
+    : sig( _sig ),
+      hint( _hint ),
+      signerSet( _signerSet ),
+      signers( _signers ),
+      requiredSigners( _requiredSigners ),
+      totalSigners( _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    CHECK( sig );
+
+    libBLS::ThresholdUtils::initCurve();
+
+    if ( signerSet.size() != totalSigners || signers.size() != totalSigners ) {
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong size of signers bitmap" );
+    }
+
+    if ( size_t( std::count( signerSet.begin(), signerSet.end(), true ) ) != requiredSigners ) {
+        throw libBLS::ThresholdUtils::IncorrectInput( "Final signer set should have t signers" );
+    }
+
+    for ( size_t i = 0; i < totalSigners; ++i ) {
+        if ( signers[i] && !signerSet[i] ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "Signer is not in final signer set:" + std::to_string( i + 1 ) );
+        }
+    }
+
+    if ( !sig->is_well_formed() ) {
+        throw libBLS::ThresholdUtils::IsNotWellFormed( "Corrupt partial signature" );
+    }
+
+    if ( hint.length() == 0 || hint.length() > 2 * BLS_MAX_COMPONENT_LEN ) {
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong BLS hint" );
+    }
+}
+
+std::shared_ptr< BLSPartialSignature > BLSPartialSignature::merge(
+    const BLSPartialSignature& other ) const {
+    if ( other.requiredSigners != requiredSigners || other.totalSigners != totalSigners ||
+         other.signerSet != signerSet ) {
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Partial signatures have different final signer sets" );
+    }
+
+    std::vector< bool > mergedSigners( signers );
+    for ( size_t i = 0; i < totalSigners; ++i ) {
+        if ( signers[i] && other.signers[i] ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "Partial signatures share signer:" + std::to_string( i + 1 ) );
+        }
+        mergedSigners[i] = signers[i] || other.signers[i];
+    }
+
+    auto mergedSig = std::make_shared< libff::alt_bn128_G1 >( *sig + *other.sig );
+    std::string mergedHint = hint;
+
+    return std::make_shared< BLSPartialSignature >(
+        mergedSig, mergedHint, signerSet, mergedSigners, requiredSigners, totalSigners );
+}
+
+bool BLSPartialSignature::isComplete() const {
+    return signers == signerSet;
+}
+
+std::shared_ptr< BLSSignature > BLSPartialSignature::toSignature() const {
+    if ( !isComplete() ) {
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Partial signature does not cover final signer set" );
+    }
+
+    std::string signatureHint = hint;
+
+    return std::make_shared< BLSSignature >( sig, signatureHint, requiredSigners, totalSigners );
+}
+
+std::shared_ptr< std::vector< uint8_t > > BLSPartialSignature::toBytes() const {
+    size_t bitmapBytes = ( totalSigners + 7 ) / 8;
+
+    auto ret = std::make_shared< std::vector< uint8_t > >(
+        1 + PARTIAL_HEADER_BYTES + 2 * bitmapBytes );
+    uint8_t* data = ret->data();
+    data[0] = BLS_BINARY_FORMAT_VERSION;
+    data += 1;
+
+    SignersCountToBytes( requiredSigners, data );
+    SignersCountToBytes( totalSigners, data + SIGNERS_COUNT_BYTES );
+    data += 2 * SIGNERS_COUNT_BYTES;
+
+    auto sig_bytes = libBLS::ThresholdUtils::G1ToBytes( *sig );
+    std::copy( sig_bytes.begin(), sig_bytes.end(), data );
+    data += BLS_G1_BYTES;
+
+    auto hint_bytes = libBLS::ThresholdUtils::HintToBytes( hint );
+    std::copy( hint_bytes.begin(), hint_bytes.end(), data );
+    data += BLS_HINT_BYTES;
+
+    BitmapToBytes( signerSet, data );
+    BitmapToBytes( signers, data + bitmapBytes );
+
+    return ret;
+}
+
+std::shared_ptr< BLSPartialSignature > BLSPartialSignature::fromBytes(
+    const std::vector< uint8_t >& bytes ) {
+    // the size depends on n, a wrong n is caught by the size check
+    size_t _totalSigners = 0;
+    if ( bytes.size() >= 1 + 2 * SIGNERS_COUNT_BYTES ) {
+        _totalSigners = SignersCountFromBytes( bytes.data() + 1 + SIGNERS_COUNT_BYTES );
+    }
+    size_t bitmapBytes = ( _totalSigners + 7 ) / 8;
+
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat(
+        bytes, PARTIAL_HEADER_BYTES + 2 * bitmapBytes );
+
+    size_t _requiredSigners = SignersCountFromBytes( data );
+    data += 2 * SIGNERS_COUNT_BYTES;
+
+    std::array< uint8_t, BLS_G1_BYTES > sig_bytes;
+    std::copy( data, data + BLS_G1_BYTES, sig_bytes.begin() );
+    data += BLS_G1_BYTES;
+
+    std::array< uint8_t, BLS_HINT_BYTES > hint_bytes;
+    std::copy( data, data + BLS_HINT_BYTES, hint_bytes.begin() );
+    data += BLS_HINT_BYTES;
+
+    std::vector< bool > _signerSet = BitmapFromBytes( data, _totalSigners );
+    std::vector< bool > _signers = BitmapFromBytes( data + bitmapBytes, _totalSigners );
+
+    auto _sig =
+        std::make_shared< libff::alt_bn128_G1 >( libBLS::ThresholdUtils::G1FromBytes( sig_bytes ) );
+    std::string _hint = libBLS::ThresholdUtils::HintFromBytes( hint_bytes );
+
+    return std::make_shared< BLSPartialSignature >(
+        _sig, _hint, _signerSet, _signers, _requiredSigners, _totalSigners );
+}
+
+std::shared_ptr< libff::alt_bn128_G1 > BLSPartialSignature::getSig() const {
+    CHECK( sig );
+    return sig;
+}
+
+std::string BLSPartialSignature::getHint() const {
+    return hint;
+}
+
+const std::vector< bool >& BLSPartialSignature::getSignerSet() const {
+    return signerSet;
+}
+
+const std::vector< bool >& BLSPartialSignature::getSigners() const {
+    return signers;
+}
+
+size_t BLSPartialSignature::getTotalSigners() const {
+    return totalSigners;
+}
+
+size_t BLSPartialSignature::getRequiredSigners() const {
+    return requiredSigners;
+}
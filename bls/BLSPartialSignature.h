@@ -0,0 +1,76 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+  @file BLSPartialSignature.h
+  @author SKALE Labs
+  @date 2026
+*/
+
+#ifndef LIBBLS_BLSPARTIALSIGNATURE_H
+#define LIBBLS_BLSPARTIALSIGNATURE_H
+
+#include <bls/bls.h>
+class BLSSignature;
+class BLSSigShare;
+
+// sum( lambda_i * sigma_i ) over a part of a known final set of t signers, where lambda_i are
+// the Lagrange coefficients of the final set. Partial signatures of disjoint parts are merged
+// in any order, the one covering the whole set is the signature
+class BLSPartialSignature {
+private:
+    std::shared_ptr< libff::alt_bn128_G1 > sig;
+    std::string hint;
+
+    // bitmaps over signer indexes 1..n, bit i - 1 is set for signer i
+    std::vector< bool > signerSet;
+    std::vector< bool > signers;
+
+    size_t requiredSigners;
+    size_t totalSigners;
+
+public:
+    // all shares should belong to signers from the final signer set
+    BLSPartialSignature( const std::vector< size_t >& finalSigners,
+        const std::vector< std::shared_ptr< BLSSigShare > >& sigShares, size_t _requiredSigners,
+        size_t _totalSigners );
+
+    BLSPartialSignature( const std::shared_ptr< libff::alt_bn128_G1 > sig, std::string& _hint,
+        const std::vector< bool >& _signerSet, const std::vector< bool >& _signers,
+        size_t _requiredSigners, size_t _totalSigners );
+
+    std::shared_ptr< BLSPartialSignature > merge( const BLSPartialSignature& other ) const;
+
+    bool isComplete() const;
+
+    std::shared_ptr< BLSSignature > toSignature() const;
+
+    // t and n are encoded too, as a relay forwards partials of a set it does not know
+    std::shared_ptr< std::vector< uint8_t > > toBytes() const;
+
+    static std::shared_ptr< BLSPartialSignature > fromBytes( const std::vector< uint8_t >& bytes );
+
+    std::shared_ptr< libff::alt_bn128_G1 > getSig() const;
+    std::string getHint() const;
+    const std::vector< bool >& getSignerSet() const;
+    const std::vector< bool >& getSigners() const;
+    size_t getTotalSigners() const;
+    size_t getRequiredSigners() const;
+};
+
+
+#endif  // LIBBLS_BLSPARTIALSIGNATURE_H
@@ -46,6 +46,19 @@ BLSPrivateKey::BLSPrivateKey(
     }
 }
 
+BLSPrivateKey::BLSPrivateKey(
+    const libff::alt_bn128_Fr& _key, size_t _requiredSigners, size_t _totalSigners )
+    : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    if ( _key == libff::alt_bn128_Fr::zero() ) {
+        throw libBLS::ThresholdUtils::ZeroSecretKey(
+            "Secret key share is equal to zero or corrupt" );
+    }
+
+    privateKey = std::make_shared< libff::alt_bn128_Fr >( _key );
+}
+
 BLSPrivateKey::BLSPrivateKey(
     std::shared_ptr< std::vector< std::shared_ptr< BLSPrivateKeyShare > > > skeys,
     std::shared_ptr< std::vector< size_t > > koefs, size_t _requiredSigners, size_t _totalSigners )
@@ -87,3 +100,24 @@ std::shared_ptr< std::string > BLSPrivateKey::toString() {
 
     return key_str;
 }
+
+std::shared_ptr< std::vector< uint8_t > > BLSPrivateKey::toBytes() {
+    auto key_bytes = libBLS::ThresholdUtils::FrToBytes( *privateKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_FR_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< BLSPrivateKey > BLSPrivateKey::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_FR_BYTES );
+
+    std::array< uint8_t, BLS_FR_BYTES > key_bytes;
+    std::copy( data, data + BLS_FR_BYTES, key_bytes.begin() );
+
+    return std::make_shared< BLSPrivateKey >(
+        libBLS::ThresholdUtils::FrFromBytes( key_bytes ), _requiredSigners, _totalSigners );
+}
@@ -40,6 +40,9 @@ public:
     BLSPrivateKey(
         const std::shared_ptr< std::string >& _key, size_t _requiredSigners, size_t _totalSigners );
 
+    BLSPrivateKey(
+        const libff::alt_bn128_Fr& _key, size_t _requiredSigners, size_t _totalSigners );
+
     BLSPrivateKey( std::shared_ptr< std::vector< std::shared_ptr< BLSPrivateKeyShare > > >,
         std::shared_ptr< std::vector< size_t > > koefs, size_t _requiredSigners,
         size_t _totalSigners );
@@ -47,6 +50,11 @@ public:
     std::shared_ptr< libff::alt_bn128_Fr > getPrivateKey() const;
 
     std::shared_ptr< std::string > toString();
+
+    std::shared_ptr< std::vector< uint8_t > > toBytes();
+
+    static std::shared_ptr< BLSPrivateKey > fromBytes(
+        const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners );
 };
 
 
@@ -58,8 +58,6 @@ BLSPrivateKeyShare::BLSPrivateKeyShare(
 
 std::shared_ptr< BLSSigShare > BLSPrivateKeyShare::sign(
     std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr, size_t _signerIndex ) {
-    std::shared_ptr< libBLS::Bls > obj;
-
     if ( _signerIndex == 0 ) {
         throw libBLS::ThresholdUtils::IncorrectInput( "Zero signer index during BLS sign" );
     }
@@ -67,16 +65,13 @@ std::shared_ptr< BLSSigShare > BLSPrivateKeyShare::sign(
         throw libBLS::ThresholdUtils::IncorrectInput( "Hash is null during BLS sign" );
     }
 
-    obj = std::make_shared< libBLS::Bls >( libBLS::Bls( requiredSigners, totalSigners ) );
-
-    libff::alt_bn128_G1 hash = libBLS::ThresholdUtils::HashtoG1( hash_byte_arr );
+    std::pair< libff::alt_bn128_G1, std::string > hash_with_hint =
+        libBLS::Bls::HashtoG1withHint( hash_byte_arr );
 
-    auto ss = std::make_shared< libff::alt_bn128_G1 >( obj->Signing( hash, *privateKey ) );
+    auto ss = std::make_shared< libff::alt_bn128_G1 >(
+        libBLS::Bls::Signing( hash_with_hint.first, *privateKey ) );
 
     ss->to_affine_coordinates();
-
-    std::pair< libff::alt_bn128_G1, std::string > hash_with_hint =
-        obj->HashtoG1withHint( hash_byte_arr );
     std::string hint = libBLS::ThresholdUtils::fieldElementToString( hash_with_hint.first.Y ) +
                        ":" + hash_with_hint.second;
 
@@ -86,6 +81,13 @@ std::shared_ptr< BLSSigShare > BLSPrivateKeyShare::sign(
     return s;
 }
 
+libBLS::SigWithHint BLSPrivateKeyShare::sign(
+    const std::array< uint8_t, 32 >& hash_byte_arr ) const {
+    CHECK( privateKey );
+
+    return libBLS::Bls::Signing( hash_byte_arr, *privateKey );
+}
+
 std::shared_ptr< BLSSigShare > BLSPrivateKeyShare::signWithHelper(
     std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr, size_t _signerIndex ) {
     std::shared_ptr< libBLS::Bls > obj;
@@ -168,3 +170,27 @@ std::shared_ptr< std::string > BLSPrivateKeyShare::toString() {
         throw libBLS::ThresholdUtils::IncorrectInput( "Secret key share string is empty" );
     return key_str;
 }
+
+std::shared_ptr< std::vector< uint8_t > > BLSPrivateKeyShare::toBytes() {
+    if ( !privateKey )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Secret key share is null" );
+
+    auto key_bytes = libBLS::ThresholdUtils::FrToBytes( *privateKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_FR_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< BLSPrivateKeyShare > BLSPrivateKeyShare::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_FR_BYTES );
+
+    std::array< uint8_t, BLS_FR_BYTES > key_bytes;
+    std::copy( data, data + BLS_FR_BYTES, key_bytes.begin() );
+
+    return std::make_shared< BLSPrivateKeyShare >(
+        libBLS::ThresholdUtils::FrFromBytes( key_bytes ), _requiredSigners, _totalSigners );
+}
@@ -47,6 +47,9 @@ public:
     std::shared_ptr< BLSSigShare > signWithHelper(
         std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr, size_t _signerIndex );
 
+    // returns the share by value and does not allocate memory
+    libBLS::SigWithHint sign( const std::array< uint8_t, 32 >& hash_byte_arr ) const;
+
     BLSPrivateKeyShare( const libff::alt_bn128_Fr&, size_t _requiredSigners, size_t _totalSigners );
 
     // generate a vector of correct _totalSigners private keys that work together and common public
@@ -60,6 +63,11 @@ public:
     std::shared_ptr< libff::alt_bn128_Fr > getPrivateKey() const;
 
     std::shared_ptr< std::string > toString();
+
+    std::shared_ptr< std::vector< uint8_t > > toBytes();
+
+    static std::shared_ptr< BLSPrivateKeyShare > fromBytes(
+        const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners );
 };
 
 
@@ -66,7 +66,8 @@ BLSPublicKey::BLSPublicKey( const libff::alt_bn128_Fr& skey, size_t t, size_t n
     // do not check signers for compatibility
     // libBLS::ThresholdUtils::checkSigners( t, n );
 
-    libffPublicKey = std::make_shared< libff::alt_bn128_G2 >( skey * libff::alt_bn128_G2::one() );
+    libffPublicKey = std::make_shared< libff::alt_bn128_G2 >(
+        libBLS::ThresholdUtils::mulGenerator( skey ) );
     if ( libffPublicKey->is_zero() ) {
         throw libBLS::ThresholdUtils::IsNotWellFormed( "Public Key is equal to zero or corrupt" );
     }
@@ -74,8 +75,6 @@ BLSPublicKey::BLSPublicKey( const libff::alt_bn128_Fr& skey, size_t t, size_t n
 
 bool BLSPublicKey::VerifySig( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
     std::shared_ptr< BLSSignature > sign_ptr ) {
-    libBLS::ThresholdUtils::initCurve();
-
     if ( !hash_ptr ) {
         throw libBLS::ThresholdUtils::IncorrectInput( "hash is null" );
     }
@@ -84,10 +83,22 @@ bool BLSPublicKey::VerifySig( std::shared_ptr< std::array< uint8_t, 32 > > hash_
         throw libBLS::ThresholdUtils::IsNotWellFormed( "Sig share is equal to zero or corrupt" );
     }
 
-    bool res = libBLS::Bls::Verification( hash_ptr, *( sign_ptr->getSig() ), *libffPublicKey );
+    bool res = libBLS::Bls::Verification(
+        hash_ptr, *( sign_ptr->getSig() ), *libffPublicKey, *getPublicKeyPrecomp() );
     return res;
 }
 
+bool BLSPublicKey::VerifySig(
+    const std::array< uint8_t, 32 >& hash_byte_arr, const libff::alt_bn128_G1& sig ) const {
+    CHECK( libffPublicKey );
+
+    if ( sig.is_zero() ) {
+        throw libBLS::ThresholdUtils::IsNotWellFormed( "Sig share is equal to zero or corrupt" );
+    }
+
+    return libBLS::Bls::Verification( hash_byte_arr, sig, *libffPublicKey, *getPublicKeyPrecomp() );
+}
+
 bool BLSPublicKey::VerifySigWithHelper( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
     std::shared_ptr< BLSSignature > sign_ptr ) {
     if ( !hash_ptr ) {
@@ -114,16 +125,13 @@ bool BLSPublicKey::VerifySigWithHelper( std::shared_ptr< std::array< uint8_t, 32
 
     libff::alt_bn128_G1 hash( x, y_shift_x.first, libff::alt_bn128_Fq::one() );
 
-    return (
-        libff::alt_bn128_ate_reduced_pairing( *sign_ptr->getSig(), libff::alt_bn128_G2::one() ) ==
-        libff::alt_bn128_ate_reduced_pairing( hash, *libffPublicKey ) );
+    return libBLS::ThresholdUtils::CheckPairing(
+        *sign_ptr->getSig(), hash, *getPublicKeyPrecomp() );
 }
 
 bool BLSPublicKey::AggregatedVerifySig(
     std::vector< std::shared_ptr< std::array< uint8_t, 32 > > >& hash_ptr_vec,
     std::vector< std::shared_ptr< BLSSignature > >& sign_ptr_vec ) {
-    libBLS::ThresholdUtils::initCurve();
-
     if ( hash_ptr_vec.size() != sign_ptr_vec.size() ) {
         throw libBLS::ThresholdUtils::IncorrectInput(
             "Number of signatures and hashes do not match" );
@@ -171,19 +179,22 @@ BLSPublicKey::BLSPublicKey(
     }
 
     std::vector< libff::alt_bn128_Fr > lagrangeCoeffs =
-        libBLS::ThresholdUtils::LagrangeCoeffs( participatingNodes, _requiredSigners );
+        libBLS::LagrangeCoeffsCache::getInstance().get( participatingNodes, _requiredSigners );
 
-    libff::alt_bn128_G2 key = libff::alt_bn128_G2::zero();
-    size_t i = 0;
+    std::vector< libff::alt_bn128_G2 > public_key_shares;
     for ( auto&& item : *koefs_pkeys_map ) {
-        if ( i < _requiredSigners ) {
-            key = key + lagrangeCoeffs.at( i ) * ( *item.second->getPublicKey() );
-            i++;
+        if ( public_key_shares.size() < _requiredSigners ) {
+            public_key_shares.push_back( *item.second->getPublicKey() );
         } else {
             break;
         }
     }
 
+    lagrangeCoeffs.resize( public_key_shares.size() );
+
+    libff::alt_bn128_G2 key =
+        libBLS::ThresholdUtils::MultiScalarMul( lagrangeCoeffs, public_key_shares );
+
     libffPublicKey = std::make_shared< libff::alt_bn128_G2 >( key );
     if ( libffPublicKey->is_zero() ) {
         throw libBLS::ThresholdUtils::IsNotWellFormed( "Public Key is equal to zero or corrupt" );
@@ -206,3 +217,36 @@ std::shared_ptr< std::vector< std::string > > BLSPublicKey::toString() {
 std::shared_ptr< libff::alt_bn128_G2 > BLSPublicKey::getPublicKey() const {
     return libffPublicKey;
 }
+
+std::shared_ptr< libff::alt_bn128_ate_G2_precomp > BLSPublicKey::getPublicKeyPrecomp() const {
+    auto precomp = std::atomic_load( &publicKeyPrecomp );
+
+    if ( !precomp ) {
+        precomp = std::make_shared< libff::alt_bn128_ate_G2_precomp >(
+            libff::alt_bn128_ate_precompute_G2( *libffPublicKey ) );
+        std::atomic_store( &publicKeyPrecomp, precomp );
+    }
+
+    return precomp;
+}
+
+std::shared_ptr< std::vector< uint8_t > > BLSPublicKey::toBytes() {
+    auto key_bytes = libBLS::ThresholdUtils::G2ToBytes( *libffPublicKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_G2_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< BLSPublicKey > BLSPublicKey::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t t, size_t n ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_G2_BYTES );
+
+    std::array< uint8_t, BLS_G2_BYTES > key_bytes;
+    std::copy( data, data + BLS_G2_BYTES, key_bytes.begin() );
+
+    return std::make_shared< BLSPublicKey >(
+        libBLS::ThresholdUtils::G2FromBytes( key_bytes ), t, n );
+}
@@ -33,6 +33,8 @@ class BLSPublicKeyShare;
 class BLSPublicKey {
 private:
     std::shared_ptr< libff::alt_bn128_G2 > libffPublicKey;
+    // Miller loop lines for the key, built on first verification
+    mutable std::shared_ptr< libff::alt_bn128_ate_G2_precomp > publicKeyPrecomp;
     size_t t;
     size_t n;
 
@@ -53,14 +55,25 @@ public:
     bool VerifySigWithHelper( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
         std::shared_ptr< BLSSignature > sign_ptr );
 
+    // does not allocate memory once the key precomputation is built
+    bool VerifySig(
+        const std::array< uint8_t, 32 >& hash_byte_arr, const libff::alt_bn128_G1& sig ) const;
+
     bool AggregatedVerifySig(
         std::vector< std::shared_ptr< std::array< uint8_t, 32 > > >& hash_ptr_vec,
         std::vector< std::shared_ptr< BLSSignature > >& sign_ptr_vec );
 
     std::shared_ptr< std::vector< std::string > > toString();
 
+    std::shared_ptr< std::vector< uint8_t > > toBytes();
+
+    static std::shared_ptr< BLSPublicKey > fromBytes(
+        const std::vector< uint8_t >& bytes, size_t t = 0, size_t n = 0 );
+
     std::shared_ptr< libff::alt_bn128_G2 > getPublicKey() const;
 
+    std::shared_ptr< libff::alt_bn128_ate_G2_precomp > getPublicKeyPrecomp() const;
+
     size_t getRequiredSigners() const { return t; }
 
     size_t getTotalSigners() const { return n; }
@@ -61,7 +61,26 @@ BLSPublicKeyShare::BLSPublicKeyShare(
     if ( _skey.is_zero() ) {
         throw libBLS::ThresholdUtils::ZeroSecretKey( "Zero BLS Secret Key" );
     }
-    publicKey = std::make_shared< libff::alt_bn128_G2 >( _skey * libff::alt_bn128_G2::one() );
+    publicKey = std::make_shared< libff::alt_bn128_G2 >(
+        libBLS::ThresholdUtils::mulGenerator( _skey ) );
+}
+
+BLSPublicKeyShare::BLSPublicKeyShare(
+    const libff::alt_bn128_G2& pkey, size_t _requiredSigners, size_t _totalSigners )
+    : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    libBLS::ThresholdUtils::initCurve();
+
+    publicKey = std::make_shared< libff::alt_bn128_G2 >( pkey );
+
+    if ( publicKey->is_zero() ) {
+        throw libBLS::ThresholdUtils::IsNotWellFormed( "Zero BLS public Key share" );
+    }
+
+    if ( !( publicKey->is_well_formed() ) ) {
+        throw libBLS::ThresholdUtils::IsNotWellFormed( "Corrupt BLS public key share" );
+    }
 }
 
 std::shared_ptr< libff::alt_bn128_G2 > BLSPublicKeyShare::getPublicKey() const {
@@ -69,6 +88,20 @@ std::shared_ptr< libff::alt_bn128_G2 > BLSPublicKeyShare::getPublicKey() const {
     return publicKey;
 }
 
+std::shared_ptr< libff::alt_bn128_ate_G2_precomp > BLSPublicKeyShare::getPublicKeyPrecomp() const {
+    CHECK( publicKey );
+
+    auto precomp = std::atomic_load( &publicKeyPrecomp );
+
+    if ( !precomp ) {
+        precomp = std::make_shared< libff::alt_bn128_ate_G2_precomp >(
+            libff::alt_bn128_ate_precompute_G2( *publicKey ) );
+        std::atomic_store( &publicKeyPrecomp, precomp );
+    }
+
+    return precomp;
+}
+
 std::shared_ptr< std::vector< std::string > > BLSPublicKeyShare::toString() {
     std::vector< std::string > pkey_str_vect;
 
@@ -82,24 +115,55 @@ std::shared_ptr< std::vector< std::string > > BLSPublicKeyShare::toString() {
     return std::make_shared< std::vector< std::string > >( pkey_str_vect );
 }
 
+std::shared_ptr< std::vector< uint8_t > > BLSPublicKeyShare::toBytes() {
+    auto key_bytes = libBLS::ThresholdUtils::G2ToBytes( *publicKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_G2_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< BLSPublicKeyShare > BLSPublicKeyShare::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_G2_BYTES );
+
+    std::array< uint8_t, BLS_G2_BYTES > key_bytes;
+    std::copy( data, data + BLS_G2_BYTES, key_bytes.begin() );
+
+    return std::make_shared< BLSPublicKeyShare >(
+        libBLS::ThresholdUtils::G2FromBytes( key_bytes ), _requiredSigners, _totalSigners );
+}
+
 bool BLSPublicKeyShare::VerifySig( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
     std::shared_ptr< BLSSigShare > sign_ptr, size_t _requiredSigners, size_t _totalSigners ) {
     CHECK( hash_ptr );
     CHECK( sign_ptr );
 
-    std::shared_ptr< libBLS::Bls > obj;
     libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
 
     if ( sign_ptr->getSigShare()->is_zero() ) {
         throw libBLS::ThresholdUtils::IsNotWellFormed( "Zero BLS Sig share" );
     }
 
-    obj = std::make_shared< libBLS::Bls >( libBLS::Bls( _requiredSigners, _totalSigners ) );
-
-    bool res = obj->Verification( hash_ptr, *( sign_ptr->getSigShare() ), *publicKey );
+    bool res = libBLS::Bls::Verification(
+        hash_ptr, *( sign_ptr->getSigShare() ), *publicKey, *getPublicKeyPrecomp() );
     return res;
 }
 
+bool BLSPublicKeyShare::VerifySig(
+    const std::array< uint8_t, 32 >& hash_byte_arr, const libff::alt_bn128_G1& sig_share ) const {
+    CHECK( publicKey );
+
+    if ( sig_share.is_zero() ) {
+        throw libBLS::ThresholdUtils::IsNotWellFormed( "Zero BLS Sig share" );
+    }
+
+    return libBLS::Bls::Verification(
+        hash_byte_arr, sig_share, *publicKey, *getPublicKeyPrecomp() );
+}
+
 bool BLSPublicKeyShare::VerifySigWithHelper( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
     std::shared_ptr< BLSSigShare > sign_ptr, size_t _requiredSigners, size_t _totalSigners ) {
     CHECK( sign_ptr )
@@ -132,7 +196,6 @@ bool BLSPublicKeyShare::VerifySigWithHelper( std::shared_ptr< std::array< uint8_
 
     libff::alt_bn128_G1 hash( x, y_shift_x.first, libff::alt_bn128_Fq::one() );
 
-    return ( libff::alt_bn128_ate_reduced_pairing(
-                 *sign_ptr->getSigShare(), libff::alt_bn128_G2::one() ) ==
-             libff::alt_bn128_ate_reduced_pairing( hash, *publicKey ) );
+    return libBLS::ThresholdUtils::CheckPairing(
+        *sign_ptr->getSigShare(), hash, *getPublicKeyPrecomp() );
 }
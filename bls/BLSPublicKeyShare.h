@@ -31,6 +31,8 @@ class BLSSigShare;
 class BLSPublicKeyShare {
 private:
     std::shared_ptr< libff::alt_bn128_G2 > publicKey;
+    // Miller loop lines for the key, built on first verification
+    mutable std::shared_ptr< libff::alt_bn128_ate_G2_precomp > publicKeyPrecomp;
     size_t requiredSigners;
     size_t totalSigners;
 
@@ -41,15 +43,29 @@ public:
     BLSPublicKeyShare(
         const libff::alt_bn128_Fr& skey, size_t _requiredSigners, size_t _totalSigners );
 
+    BLSPublicKeyShare(
+        const libff::alt_bn128_G2& pkey, size_t _requiredSigners, size_t _totalSigners );
+
     std::shared_ptr< libff::alt_bn128_G2 > getPublicKey() const;
 
+    std::shared_ptr< libff::alt_bn128_ate_G2_precomp > getPublicKeyPrecomp() const;
+
     bool VerifySig( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
         std::shared_ptr< BLSSigShare > sign_ptr, size_t _requiredSigners, size_t _totalSigners );
 
     bool VerifySigWithHelper( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
         std::shared_ptr< BLSSigShare > sign_ptr, size_t _requiredSigners, size_t _totalSigners );
 
+    // does not allocate memory once the key precomputation is built
+    bool VerifySig( const std::array< uint8_t, 32 >& hash_byte_arr,
+        const libff::alt_bn128_G1& sig_share ) const;
+
     std::shared_ptr< std::vector< std::string > > toString();
+
+    std::shared_ptr< std::vector< uint8_t > > toBytes();
+
+    static std::shared_ptr< BLSPublicKeyShare > fromBytes(
+        const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners );
 };
 
 #endif  // LIBBLS_BLSPUBLICKEYSHARE_H
@@ -134,3 +134,33 @@ size_t BLSSigShare::getRequiredSigners() const {
 std::string BLSSigShare::getHint() const {
     return hint;
 }
+
+std::shared_ptr< std::vector< uint8_t > > BLSSigShare::toBytes() {
+    auto sig_bytes = libBLS::ThresholdUtils::G1ToBytes( *sigShare );
+    auto hint_bytes = libBLS::ThresholdUtils::HintToBytes( hint );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_G1_BYTES + BLS_HINT_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( sig_bytes.begin(), sig_bytes.end(), ret->begin() + 1 );
+    std::copy( hint_bytes.begin(), hint_bytes.end(), ret->begin() + 1 + BLS_G1_BYTES );
+
+    return ret;
+}
+
+std::shared_ptr< BLSSigShare > BLSSigShare::fromBytes( const std::vector< uint8_t >& bytes,
+    size_t _signerIndex, size_t _requiredSigners, size_t _totalSigners ) {
+    const uint8_t* data =
+        libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_G1_BYTES + BLS_HINT_BYTES );
+
+    std::array< uint8_t, BLS_G1_BYTES > sig_bytes;
+    std::copy( data, data + BLS_G1_BYTES, sig_bytes.begin() );
+    std::array< uint8_t, BLS_HINT_BYTES > hint_bytes;
+    std::copy( data + BLS_G1_BYTES, data + BLS_G1_BYTES + BLS_HINT_BYTES, hint_bytes.begin() );
+
+    auto sigShare = std::make_shared< libff::alt_bn128_G1 >(
+        libBLS::ThresholdUtils::G1FromBytes( sig_bytes ) );
+    std::string hint = libBLS::ThresholdUtils::HintFromBytes( hint_bytes );
+
+    return std::make_shared< BLSSigShare >(
+        sigShare, hint, _signerIndex, _requiredSigners, _totalSigners );
+}
@@ -52,6 +52,11 @@ public:
     std::string getHint() const;
 
     std::shared_ptr< std::string > toString();
+
+    std::shared_ptr< std::vector< uint8_t > > toBytes();
+
+    static std::shared_ptr< BLSSigShare > fromBytes( const std::vector< uint8_t >& bytes,
+        size_t signerIndex, size_t _requiredSigners, size_t _totalSigners );
     size_t getTotalSigners() const;
     size_t getRequiredSigners() const;
 };
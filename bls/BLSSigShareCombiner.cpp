@@ -0,0 +1,170 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS. If not, see <https://www.gnu.org/licenses/>.
+
+  @file BLSSigShareCombiner.cpp
+  @author SKALE Labs
+  @date 2026
+*/
+
+#include <algorithm>
+
+#include <bls/BLSSigShare.h>
+#include <bls/BLSSigShareCombiner.h>
+#include <bls/BLSSignature.h>
+
+
+BLSSigShareCombiner::BLSSigShareCombiner( size_t _requiredSigners, size_t _totalSigners )
+    : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    libBLS::ThresholdUtils::initCurve();
+
+    indexesProduct = libff::alt_bn128_Fr::one();
+
+    if ( requiredSigners == 1 ) {
+        prepareLastSigners();
+    }
+}
+
+bool BLSSigShareCombiner::addSigShare( std::shared_ptr< BLSSigShare > _sigShare ) {
+    CHECK( _sigShare );
+
+    if ( isEnough() ) {
+        return false;
+    }
+
+    size_t index = _sigShare->getSignerIndex();
+    if ( index == 0 || index > totalSigners ) {
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Index out of range:" + std::to_string( index ) );
+    }
+
+    for ( auto&& sigShare : sigShares ) {
+        if ( sigShare->getSignerIndex() == index ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "Already have this index:" + std::to_string( index ) );
+        }
+    }
+
+    if ( !_sigShare->getSigShare()->is_well_formed() ) {
+        throw libBLS::ThresholdUtils::IsNotWellFormed(
+            "incorrect input data to recover signature" );
+    }
+
+    sigShares.push_back( _sigShare );
+
+    // the last share is merged with the sums prepared for it
+    if ( isEnough() ) {
+        return true;
+    }
+
+    libff::alt_bn128_Fr signerIndex( index );
+
+    libff::alt_bn128_Fr denominator = signerIndex;
+    for ( size_t i = 0; i < signerIndexes.size(); ++i ) {
+        denominators[i] *= signerIndex - signerIndexes[i];
+        denominator *= signerIndexes[i] - signerIndex;
+    }
+
+    sigShareTables.emplace_back( *_sigShare->getSigShare() );
+    signerIndexes.push_back( signerIndex );
+    denominators.push_back( denominator );
+    indexesProduct *= signerIndex;
+
+    if ( sigShares.size() + 1 == requiredSigners ) {
+        prepareLastSigners();
+    }
+
+    return true;
+}
+
+void BLSSigShareCombiner::prepareLastSigners() {
+    size_t numShares = signerIndexes.size();
+
+    // Lagrange coefficients of the shares so far are prod( idx_i ) / denominators
+    std::vector< libff::alt_bn128_Fr > lagrangeCoeffs = denominators;
+    libBLS::ThresholdUtils::BatchInvert( lagrangeCoeffs );
+    for ( auto& coeff : lagrangeCoeffs ) {
+        coeff *= indexesProduct;
+    }
+
+    std::vector< size_t > lastSigners;
+    for ( size_t index = 1; index <= totalSigners; ++index ) {
+        if ( std::find( signerIndexes.begin(), signerIndexes.end(),
+                 libff::alt_bn128_Fr( index ) ) == signerIndexes.end() ) {
+            lastSigners.push_back( index );
+        }
+    }
+
+    // a last signer idx multiplies lambda_i by idx / ( idx - idx_i ) and gets
+    // lambda = prod( idx_i ) / prod( idx_i - idx ), all of the differences are inverted at once
+    std::vector< libff::alt_bn128_Fr > differences;
+    differences.reserve( lastSigners.size() * ( numShares + 1 ) );
+    for ( size_t index : lastSigners ) {
+        libff::alt_bn128_Fr lastIndex( index );
+        libff::alt_bn128_Fr product = libff::alt_bn128_Fr::one();
+        for ( size_t i = 0; i < numShares; ++i ) {
+            differences.push_back( lastIndex - signerIndexes[i] );
+            product *= signerIndexes[i] - lastIndex;
+        }
+        differences.push_back( product );
+    }
+    libBLS::ThresholdUtils::BatchInvert( differences );
+
+    lastSignerSums.assign( totalSigners, libff::alt_bn128_G1::zero() );
+    lastSignerCoeffs.assign( totalSigners, libff::alt_bn128_Fr::zero() );
+
+    libBLS::ThresholdUtils::ParallelFor( lastSigners.size(), [&]( size_t begin, size_t end ) {
+        for ( size_t j = begin; j < end; ++j ) {
+            libff::alt_bn128_Fr lastIndex( lastSigners[j] );
+            const libff::alt_bn128_Fr* inverses = &differences[j * ( numShares + 1 )];
+
+            std::vector< libff::bigint< 1 > > digits;
+            std::vector< libff::alt_bn128_G1 > points;
+            for ( size_t i = 0; i < numShares; ++i ) {
+                sigShareTables[i].addTerms(
+                    lagrangeCoeffs[i] * lastIndex * inverses[i], digits, points );
+            }
+
+            lastSignerSums[lastSigners[j] - 1] =
+                libBLS::ThresholdUtils::MultiScalarMul( digits, points );
+            lastSignerCoeffs[lastSigners[j] - 1] = indexesProduct * inverses[numShares];
+        }
+    } );
+}
+
+bool BLSSigShareCombiner::isEnough() {
+    return ( sigShares.size() >= requiredSigners );
+}
+
+std::shared_ptr< BLSSignature > BLSSigShareCombiner::merge() {
+    if ( !isEnough() )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Not enough shares to create signature" );
+
+    const std::shared_ptr< BLSSigShare >& lastShare = sigShares.at( requiredSigners - 1 );
+    size_t lastIndex = lastShare->getSignerIndex();
+
+    libff::alt_bn128_G1 signature = lastSignerSums[lastIndex - 1] +
+                                    lastSignerCoeffs[lastIndex - 1] * *lastShare->getSigShare();
+
+    auto sigPtr = std::make_shared< libff::alt_bn128_G1 >( signature );
+
+    std::string hint = sigShares.at( 0 )->getHint();
+
+    return std::make_shared< BLSSignature >( sigPtr, hint, requiredSigners, totalSigners );
+}
@@ -0,0 +1,72 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+  @file BLSSigShareCombiner.h
+  @author SKALE Labs
+  @date 2026
+*/
+
+#ifndef LIBBLS_BLSSIGSHARECOMBINER_H
+#define LIBBLS_BLSSIGSHARECOMBINER_H
+
+#include <bls/bls.h>
+#include <tools/utils.h>
+class BLSSignature;
+class BLSSigShare;
+
+// merges the first t signature shares it gets, doing most of the work as they arrive: every
+// share gets its multiplication table and the Lagrange denominators are updated. Once t - 1
+// shares are in, the sum of their shares is prepared for every signer that may come last, so
+// after the t-th share the merge takes one scalar multiplication and one addition
+class BLSSigShareCombiner {
+private:
+    size_t requiredSigners;
+    size_t totalSigners;
+
+    std::vector< std::shared_ptr< BLSSigShare > > sigShares;
+
+    std::vector< libBLS::G1FixedBaseTable > sigShareTables;
+
+    std::vector< libff::alt_bn128_Fr > signerIndexes;
+
+    // idx_i * prod( idx_j - idx_i ) over the other shares added so far
+    std::vector< libff::alt_bn128_Fr > denominators;
+
+    // prod( idx_i ) over the shares added so far
+    libff::alt_bn128_Fr indexesProduct;
+
+    // by the index of the last signer, sum( lambda_i * sigma_i ) over the other t - 1 shares
+    // and lambda of the last share, with lambdas of the final signer set
+    std::vector< libff::alt_bn128_G1 > lastSignerSums;
+    std::vector< libff::alt_bn128_Fr > lastSignerCoeffs;
+
+    void prepareLastSigners();
+
+public:
+    BLSSigShareCombiner( size_t requiredSigners, size_t totalSigners );
+
+    // returns false if the combiner already has enough shares and does not need this one
+    bool addSigShare( std::shared_ptr< BLSSigShare > _sigShare );
+
+    bool isEnough();
+
+    std::shared_ptr< BLSSignature > merge();
+};
+
+
+#endif  // LIBBLS_BLSSIGSHARECOMBINER_H
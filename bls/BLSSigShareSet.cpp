@@ -24,6 +24,9 @@
 #include <stdint.h>
 #include <string>
 
+#include <bls/BLSPartialSignature.h>
+#include <bls/BLSPublicKey.h>
+#include <bls/BLSPublicKeyShare.h>
 #include <bls/BLSSigShare.h>
 #include <bls/BLSSigShareSet.h>
 #include <bls/BLSSignature.h>
@@ -78,6 +81,60 @@ std::shared_ptr< BLSSignature > BLSSigShareSet::merge() {
         throw libBLS::ThresholdUtils::IncorrectInput( "Not enough shares to create signature" );
 
     was_merged = true;
+
+    return mergeShares();
+}
+
+std::shared_ptr< BLSSignature > BLSSigShareSet::mergeVerified(
+    std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
+    std::shared_ptr< BLSPublicKey > commonPublicKey,
+    std::shared_ptr< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > > publicKeyShares ) {
+    CHECK( hash_ptr );
+    CHECK( commonPublicKey );
+    CHECK( publicKeyShares );
+
+    if ( !isEnough() )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Not enough shares to create signature" );
+
+    // a single check of the merged signature is enough if all shares are valid
+    std::shared_ptr< BLSSignature > signature;
+    try {
+        signature = mergeShares();
+    } catch ( libBLS::ThresholdUtils::IncorrectInput& ) {
+        // invalid shares may add up to zero
+    }
+
+    if ( signature && commonPublicKey->VerifySig( hash_ptr, signature ) ) {
+        was_merged = true;
+        return signature;
+    }
+
+    std::vector< size_t > failedSigners = verifyAll( hash_ptr, publicKeyShares );
+
+    // all shares are valid under their keys, so the keys do not belong to the common key
+    if ( failedSigners.empty() )
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Merged signature does not verify under common public key" );
+
+    for ( size_t signerIndex : failedSigners ) {
+        sigShares.erase( signerIndex );
+    }
+
+    if ( !isEnough() )
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Not enough valid shares to create signature" );
+
+    signature = mergeShares();
+    if ( !commonPublicKey->VerifySig( hash_ptr, signature ) )
+        throw libBLS::ThresholdUtils::IncorrectInput(
+            "Merged signature does not verify under common public key" );
+
+    was_merged = true;
+
+    return signature;
+}
+
+std::shared_ptr< BLSSignature > BLSSigShareSet::mergeShares() {
     libBLS::Bls obj = libBLS::Bls( requiredSigners, totalSigners );
 
     std::vector< size_t > participatingNodes;
@@ -89,7 +146,7 @@ std::shared_ptr< BLSSignature > BLSSigShareSet::merge() {
     }
 
     std::vector< libff::alt_bn128_Fr > lagrangeCoeffs =
-        libBLS::ThresholdUtils::LagrangeCoeffs( participatingNodes, requiredSigners );
+        libBLS::LagrangeCoeffsCache::getInstance().get( participatingNodes, requiredSigners );
 
     libff::alt_bn128_G1 signature = obj.SignatureRecover( shares, lagrangeCoeffs );
 
@@ -99,3 +156,49 @@ std::shared_ptr< BLSSignature > BLSSigShareSet::merge() {
 
     return std::make_shared< BLSSignature >( sigPtr, hint, requiredSigners, totalSigners );
 }
+
+std::shared_ptr< BLSPartialSignature > BLSSigShareSet::mergePartial(
+    const std::vector< size_t >& finalSigners ) {
+    std::vector< std::shared_ptr< BLSSigShare > > partShares;
+    for ( size_t index : finalSigners ) {
+        auto sigShare = sigShares.find( index );
+        if ( sigShare != sigShares.end() ) {
+            partShares.push_back( sigShare->second );
+        }
+    }
+
+    return std::make_shared< BLSPartialSignature >(
+        finalSigners, partShares, requiredSigners, totalSigners );
+}
+
+std::vector< size_t > BLSSigShareSet::verifyAll(
+    std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
+    std::shared_ptr< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > > publicKeyShares ) {
+    CHECK( hash_ptr );
+    CHECK( publicKeyShares );
+
+    std::vector< size_t > signerIndexes;
+    std::vector< libff::alt_bn128_G1 > shares;
+    std::vector< libff::alt_bn128_G2 > publicKeys;
+
+    for ( auto&& item : sigShares ) {
+        auto publicKeyShare = publicKeyShares->find( item.first );
+        if ( publicKeyShare == publicKeyShares->end() || !publicKeyShare->second ) {
+            throw libBLS::ThresholdUtils::IncorrectInput(
+                "No public key share for signer:" + std::to_string( item.first ) );
+        }
+
+        signerIndexes.push_back( item.first );
+        shares.push_back( *item.second->getSigShare() );
+        publicKeys.push_back( *publicKeyShare->second->getPublicKey() );
+    }
+
+    libff::alt_bn128_G1 hash = libBLS::ThresholdUtils::HashtoG1( hash_ptr );
+
+    std::vector< size_t > badSigners;
+    for ( size_t position : libBLS::Bls::BatchVerifySameHash( hash, shares, publicKeys ) ) {
+        badSigners.push_back( signerIndexes.at( position ) );
+    }
+
+    return badSigners;
+}
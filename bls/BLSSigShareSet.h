@@ -24,8 +24,14 @@
 #ifndef LIBBLS_BLSSIGSHARESET_H
 #define LIBBLS_BLSSIGSHARESET_H
 
+#include <map>
+
 #include <bls/bls.h>
+class BLSPartialSignature;
 class BLSSignature;
+class BLSSigShare;
+class BLSPublicKey;
+class BLSPublicKeyShare;
 
 class BLSSigShareSet {
 private:
@@ -36,6 +42,8 @@ private:
 
     std::map< size_t, std::shared_ptr< BLSSigShare > > sigShares;
 
+    std::shared_ptr< BLSSignature > mergeShares();
+
 public:
     BLSSigShareSet( size_t requiredSigners, size_t totalSigners );
 
@@ -46,6 +54,23 @@ public:
     unsigned long getTotalSigSharesCount();
     std::shared_ptr< BLSSigShare > getSigShareByIndex( size_t _index );
     std::shared_ptr< BLSSignature > merge();
+
+    // merges and checks the signature against the common public key, only if it is invalid
+    // the shares are verified, invalid ones are removed from the set and the rest is merged
+    std::shared_ptr< BLSSignature > mergeVerified(
+        std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
+        std::shared_ptr< BLSPublicKey > commonPublicKey,
+        std::shared_ptr< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >
+            publicKeyShares );
+
+    // partial signature of the shares whose signers are in the final signer set
+    std::shared_ptr< BLSPartialSignature > mergePartial(
+        const std::vector< size_t >& finalSigners );
+
+    // checks all shares at once, returns indexes of signers whose shares are invalid
+    std::vector< size_t > verifyAll( std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr,
+        std::shared_ptr< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >
+            publicKeyShares );
 };
 
 
@@ -41,6 +41,11 @@ public:
     std::shared_ptr< libff::alt_bn128_G1 > getSig() const;
     std::shared_ptr< std::string > toString();
 
+    std::shared_ptr< std::vector< uint8_t > > toBytes();
+
+    static std::shared_ptr< BLSSignature > fromBytes(
+        const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners );
+
     std::string getHint() const;
     size_t getTotalSigners() const;
     size_t getRequiredSigners() const;
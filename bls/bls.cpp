@@ -25,16 +25,14 @@ along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
 #include <bls/bls.h>
 #include <tools/utils.h>
 
+#include <algorithm>
 #include <bitset>
-#include <chrono>
-#include <ctime>
+#include <map>
 #include <stdexcept>
-#include <thread>
 
 #include <boost/multiprecision/cpp_int.hpp>
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pairing.hpp>
 #include <libff/algebra/exponentiation/exponentiation.hpp>
-#include <libff/common/profiling.hpp>
 
 namespace libBLS {
 
@@ -52,7 +50,7 @@ std::pair< libff::alt_bn128_Fr, libff::alt_bn128_G2 > Bls::KeyGeneration() {
     }
 
     const libff::alt_bn128_G2 public_key =
-        secret_key * libff::alt_bn128_G2::one();  // public key generation
+        ThresholdUtils::mulGenerator( secret_key );  // public key generation
 
     return std::make_pair( secret_key, public_key );
 }
@@ -82,49 +80,11 @@ std::pair< libff::alt_bn128_G1, std::string > Bls::HashtoG1withHint(
     std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr ) {
     CHECK( hash_byte_arr );
 
-    libff::alt_bn128_G1 point;
-    libff::alt_bn128_Fq counter = libff::alt_bn128_Fq::zero();
-    libff::alt_bn128_Fq x1( ThresholdUtils::HashToFq( hash_byte_arr ) );
+    // hint is the number of times x was incremented until x^3 + b became a square
+    std::pair< libff::alt_bn128_G1, uint64_t > point =
+        HashToG1Cache::getInstance().get( hash_byte_arr );
 
-
-    while ( true ) {
-        libff::alt_bn128_Fq y1_sqr = x1 ^ 3;
-        y1_sqr = y1_sqr + libff::alt_bn128_coeff_b;
-
-        libff::alt_bn128_Fq euler = y1_sqr ^ libff::alt_bn128_Fq::euler;
-
-        if ( euler == libff::alt_bn128_Fq::one() ||
-             euler == libff::alt_bn128_Fq::zero() ) {  // if y1_sqr is a square
-            point.X = x1;
-            libff::alt_bn128_Fq temp_y = y1_sqr.sqrt();
-
-            mpz_t pos_y;
-            mpz_init( pos_y );
-
-            temp_y.as_bigint().to_mpz( pos_y );
-
-            mpz_t neg_y;
-            mpz_init( neg_y );
-
-            ( -temp_y ).as_bigint().to_mpz( neg_y );
-
-            if ( mpz_cmp( pos_y, neg_y ) < 0 ) {
-                temp_y = -temp_y;
-            }
-
-            mpz_clear( pos_y );
-            mpz_clear( neg_y );
-
-            point.Y = temp_y;
-            break;
-        } else {
-            counter = counter + libff::alt_bn128_Fq::one();
-            x1 = x1 + libff::alt_bn128_Fq::one();
-        }
-    }
-    point.Z = libff::alt_bn128_Fq::one();
-
-    return std::make_pair( point, ThresholdUtils::fieldElementToString( counter ) );
+    return std::make_pair( point.first, std::to_string( point.second ) );
 }
 
 libff::alt_bn128_G1 Bls::HashBytes(
@@ -181,29 +141,33 @@ std::pair< libff::alt_bn128_G1, std::string > Bls::HashPublicKeyToG1WithHint(
 libff::alt_bn128_G1 Bls::Signing(
     const libff::alt_bn128_G1 hash, const libff::alt_bn128_Fr secret_key ) {
     // sign a message with its hash and secret key
-    // implemented constant time signing
+    // the time it takes does not depend on the secret key
 
     if ( secret_key == libff::alt_bn128_Fr::zero() ) {
         throw ThresholdUtils::ZeroSecretKey( "failed to sign a message hash" );
     }
 
-    std::clock_t c_start = std::clock();  // hash
+    const libff::alt_bn128_G1 sign = ThresholdUtils::ConstantTimeMul( secret_key, hash );  // sign
 
-    const libff::alt_bn128_G1 sign = secret_key.as_bigint() * hash;  // sign
+    return sign;
+}
 
-    std::clock_t c_end = std::clock();
+SigWithHint Bls::Signing(
+    const std::array< uint8_t, 32 >& hash_byte_arr, const libff::alt_bn128_Fr& secret_key ) {
+    std::pair< libff::alt_bn128_G1, uint64_t > hash =
+        ThresholdUtils::HashtoG1WithCounter( hash_byte_arr );
 
-    std::this_thread::sleep_for(
-        std::chrono::microseconds( 10000 - 1000000 * ( c_end - c_start ) / CLOCKS_PER_SEC ) );
+    SigWithHint result{ Signing( hash.first, secret_key ), hash.first.Y, hash.second };
+    result.sig.to_affine_coordinates();
 
-    return sign;
+    return result;
 }
 
 libff::alt_bn128_G1 Bls::CoreSignAggregated(
     const std::string& message, const libff::alt_bn128_Fr secret_key ) {
     libff::alt_bn128_G1 hash = ThresholdUtils::HashtoG1( message );
 
-    return secret_key * hash;
+    return ThresholdUtils::ConstantTimeMul( secret_key, hash );
 }
 
 libff::alt_bn128_G1 Bls::Aggregate( const std::vector< libff::alt_bn128_G1 >& signatures ) {
@@ -229,8 +193,7 @@ bool Bls::CoreVerify( const libff::alt_bn128_G2& public_key, const std::string&
 
     libff::alt_bn128_G1 hash = ThresholdUtils::HashtoG1( message );
 
-    return libff::alt_bn128_ate_reduced_pairing( hash, public_key ) ==
-           libff::alt_bn128_ate_reduced_pairing( signature, libff::alt_bn128_G2::one() );
+    return ThresholdUtils::CheckPairing( signature, hash, public_key );
 }
 
 bool Bls::FastAggregateVerify( const std::vector< libff::alt_bn128_G2 >& public_keys,
@@ -245,8 +208,6 @@ bool Bls::Verification( const std::string& to_be_hashed, const libff::alt_bn128_
     const libff::alt_bn128_G2 public_key ) {
     // verifies that a given signature corresponds to given public key
 
-    libff::inhibit_profiling_info = true;
-
     if ( !sign.is_well_formed() ) {
         throw ThresholdUtils::IsNotWellFormed(
             "Error, signature does not lie on the alt_bn128 curve" );
@@ -262,8 +223,7 @@ bool Bls::Verification( const std::string& to_be_hashed, const libff::alt_bn128_
 
     libff::alt_bn128_G1 hash = Hashing( to_be_hashed );
 
-    return ( libff::alt_bn128_ate_reduced_pairing( sign, libff::alt_bn128_G2::one() ) ==
-             libff::alt_bn128_ate_reduced_pairing( hash, public_key ) );
+    return ThresholdUtils::CheckPairing( sign, hash, public_key );
     // there are several types of pairing, it does not matter which one is chosen for verification
 }
 
@@ -271,9 +231,20 @@ bool Bls::Verification( std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_a
     const libff::alt_bn128_G1 sign, const libff::alt_bn128_G2 public_key ) {
     CHECK( hash_byte_arr );
 
-    // verifies that a given signature corresponds to given public key
+    if ( public_key.is_zero() ) {
+        return false;
+    }
 
-    libff::inhibit_profiling_info = true;
+    return Verification(
+        hash_byte_arr, sign, public_key, libff::alt_bn128_ate_precompute_G2( public_key ) );
+}
+
+bool Bls::Verification( std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr,
+    const libff::alt_bn128_G1 sign, const libff::alt_bn128_G2 public_key,
+    const libff::alt_bn128_ate_G2_precomp& public_key_precomp ) {
+    CHECK( hash_byte_arr );
+
+    // verifies that a given signature corresponds to given public key
 
     if ( !sign.is_well_formed() ) {
         throw ThresholdUtils::IsNotWellFormed(
@@ -290,30 +261,95 @@ bool Bls::Verification( std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_a
 
     libff::alt_bn128_G1 hash = ThresholdUtils::HashtoG1( hash_byte_arr );
 
-    return ( libff::alt_bn128_ate_reduced_pairing( sign, libff::alt_bn128_G2::one() ) ==
-             libff::alt_bn128_ate_reduced_pairing( hash, public_key ) );
+    return ThresholdUtils::CheckPairing( sign, hash, public_key_precomp );
     // there are several types of pairing, it does not matter which one is chosen for verification
 }
 
-bool Bls::AggregatedVerification(
-    std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > hash_byte_arr,
-    const std::vector< libff::alt_bn128_G1 > sign, const libff::alt_bn128_G2 public_key ) {
-    for ( auto& hash : hash_byte_arr ) {
-        CHECK( hash );
+bool Bls::Verification( const std::array< uint8_t, 32 >& hash_byte_arr,
+    const libff::alt_bn128_G1& sign, const libff::alt_bn128_G2& public_key,
+    const libff::alt_bn128_ate_G2_precomp& public_key_precomp ) {
+    if ( !sign.is_well_formed() ) {
+        throw ThresholdUtils::IsNotWellFormed(
+            "Error, signature does not lie on the alt_bn128 curve" );
+    }
+
+    if ( !public_key.is_well_formed() ) {
+        throw ThresholdUtils::IsNotWellFormed( "Error, public key is invalid" );
     }
 
-    libff::inhibit_profiling_info = true;
+    if ( libff::alt_bn128_modulus_r * sign != libff::alt_bn128_G1::zero() ) {
+        throw ThresholdUtils::IsNotWellFormed( "Error, signature is not member of G1" );
+    }
+
+    // the hash cache allocates on a miss, so the point is computed directly
+    libff::alt_bn128_G1 hash = ThresholdUtils::HashtoG1WithCounter( hash_byte_arr ).first;
 
-    for ( auto& sig : sign ) {
-        if ( !sig.is_well_formed() ) {
+    return ThresholdUtils::CheckPairing( sign, hash, public_key_precomp );
+}
+
+std::vector< size_t > Bls::BatchVerifySameHash( const libff::alt_bn128_G1& hash,
+    const std::vector< libff::alt_bn128_G1 >& signs,
+    const std::vector< libff::alt_bn128_G2 >& public_keys ) {
+    // returns positions of signatures that do not match their public keys
+
+    if ( signs.size() != public_keys.size() ) {
+        throw ThresholdUtils::IncorrectInput( "Number of signatures and public keys do not match" );
+    }
+
+    for ( size_t i = 0; i < signs.size(); ++i ) {
+        if ( !signs[i].is_well_formed() ) {
             throw ThresholdUtils::IsNotWellFormed(
                 "Error, signature does not lie on the alt_bn128 curve" );
         }
-        if ( libff::alt_bn128_modulus_r * sig != libff::alt_bn128_G1::zero() ) {
-            throw ThresholdUtils::IsNotWellFormed( "Error, signature is not member of G1" );
+
+        if ( !public_keys[i].is_well_formed() ) {
+            throw ThresholdUtils::IsNotWellFormed( "Error, public key is invalid" );
         }
     }
 
+    std::vector< size_t > failed;
+
+    if ( signs.empty() ) {
+        return failed;
+    }
+
+    // e(sum r_i * sig_i, g2) == e(hash, sum r_i * pk_i) for random r_i holds with overwhelming
+    // probability only if every e(sig_i, g2) == e(hash, pk_i) holds. Prefix sums let any
+    // contiguous range be checked with a single pairing check while bisecting
+    auto weights = ThresholdUtils::GenerateBatchWeights( signs.size() );
+
+    std::vector< libff::alt_bn128_G1 > sign_prefix( signs.size() + 1, libff::alt_bn128_G1::zero() );
+    std::vector< libff::alt_bn128_G2 > public_key_prefix(
+        public_keys.size() + 1, libff::alt_bn128_G2::zero() );
+
+    for ( size_t i = 0; i < signs.size(); ++i ) {
+        sign_prefix[i + 1] = sign_prefix[i] + weights[i] * signs[i];
+        public_key_prefix[i + 1] = public_key_prefix[i] + weights[i] * public_keys[i];
+    }
+
+    auto check = [&]( size_t begin, size_t end ) {
+        return ThresholdUtils::CheckPairing( sign_prefix[end] - sign_prefix[begin], hash,
+            public_key_prefix[end] - public_key_prefix[begin] );
+    };
+
+    if ( !check( 0, signs.size() ) ) {
+        ThresholdUtils::BisectFailedBatch( 0, signs.size(), check, failed );
+    }
+
+    return failed;
+}
+
+bool Bls::AggregatedVerification(
+    std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > hash_byte_arr,
+    const std::vector< libff::alt_bn128_G1 > sign, const libff::alt_bn128_G2 public_key ) {
+    for ( auto& hash : hash_byte_arr ) {
+        CHECK( hash );
+    }
+
+    if ( hash_byte_arr.size() != sign.size() ) {
+        throw ThresholdUtils::IncorrectInput( "Number of signatures and hashes do not match" );
+    }
+
     if ( !public_key.is_well_formed() ) {
         throw ThresholdUtils::IsNotWellFormed( "Error, public key is invalid" );
     }
@@ -322,18 +358,182 @@ bool Bls::AggregatedVerification(
         throw ThresholdUtils::IsNotWellFormed( "Error, public key is not member of G2" );
     }
 
-    libff::alt_bn128_G1 aggregated_hash = libff::alt_bn128_G1::zero();
-    for ( std::shared_ptr< std::array< uint8_t, 32 > >& hash : hash_byte_arr ) {
-        aggregated_hash = aggregated_hash + ThresholdUtils::HashtoG1( hash );
+    // an empty batch has nothing to reject
+    if ( sign.empty() ) {
+        return true;
+    }
+
+    // plain sums of hashes and signatures let errors in different signatures cancel out,
+    // so every pair is scaled by its own random weight
+    // e( sum( w_i * sig_i ), g2 ) == e( sum( w_i * H( m_i ) ), pk )
+    auto weights = ThresholdUtils::GenerateBatchWeights( sign.size() );
+
+    std::vector< libff::alt_bn128_G1 > hashes( sign.size() );
+
+    // catch-up batches consist of historical hashes, so they bypass HashToG1Cache
+    ThresholdUtils::ParallelFor( sign.size(), [&]( size_t begin, size_t end ) {
+        for ( size_t i = begin; i < end; ++i ) {
+            if ( !sign[i].is_well_formed() ) {
+                throw ThresholdUtils::IsNotWellFormed(
+                    "Error, signature does not lie on the alt_bn128 curve" );
+            }
+            if ( libff::alt_bn128_modulus_r * sign[i] != libff::alt_bn128_G1::zero() ) {
+                throw ThresholdUtils::IsNotWellFormed( "Error, signature is not member of G1" );
+            }
+
+            hashes[i] = ThresholdUtils::HashtoG1( *hash_byte_arr[i] );
+        }
+    } );
+
+    // sum( w_i * sig_i ) and sum( w_i * H( m_i ) ) are independent, each gets its own thread
+    const std::vector< libff::alt_bn128_G1 >* terms[2] = { &sign, &hashes };
+    libff::alt_bn128_G1 aggregated[2];
+    ThresholdUtils::ParallelFor( 2, [&]( size_t begin, size_t end ) {
+        for ( size_t i = begin; i < end; ++i ) {
+            aggregated[i] = ThresholdUtils::MultiScalarMul( weights, *terms[i] );
+        }
+    } );
+
+    return ThresholdUtils::CheckPairing( aggregated[0], aggregated[1], public_key );
+}
+
+std::vector< size_t > Bls::BatchVerify(
+    const std::vector< std::tuple< std::shared_ptr< std::array< uint8_t, 32 > >,
+        libff::alt_bn128_G1, libff::alt_bn128_G2 > >& entries ) {
+    // returns sorted positions of (hash, signature, public key) entries that do not verify
+
+    std::vector< size_t > failed;
+
+    // entries signed with the same key are grouped together, so that each key adds a single
+    // pair to the product e( -sum( w_i * sig_i ), g2 ) * prod_k e( sum( w_i * H( m_i ) ), pk_k )
+    std::vector< libff::alt_bn128_G2 > affine_keys( entries.size() );
+    for ( size_t i = 0; i < entries.size(); ++i ) {
+        CHECK( std::get< 0 >( entries[i] ) );
+
+        affine_keys[i] = std::get< 2 >( entries[i] );
+        if ( affine_keys[i].is_zero() || !affine_keys[i].is_well_formed() ) {
+            throw ThresholdUtils::IsNotWellFormed( "Error, public key is invalid" );
+        }
+    }
+
+    // keys are compared by their affine coordinates, all of them are normalized with a single
+    // field inversion
+    libff::alt_bn128_G2::batch_to_special_all_non_zeros( affine_keys );
+
+    typedef std::array< mp_limb_t, 4 * libff::alt_bn128_q_limbs > KeyCoordinates;
+    std::map< KeyCoordinates, size_t > key_ids;
+    std::vector< libff::alt_bn128_G2 > keys;
+    std::vector< size_t > entry_keys( entries.size() );
+
+    for ( size_t i = 0; i < entries.size(); ++i ) {
+        const libff::alt_bn128_G2& public_key = std::get< 2 >( entries[i] );
+
+        KeyCoordinates coordinates;
+        auto limbs = coordinates.begin();
+        for ( const libff::alt_bn128_Fq* coordinate : { &affine_keys[i].X.c0,
+                  &affine_keys[i].X.c1, &affine_keys[i].Y.c0, &affine_keys[i].Y.c1 } ) {
+            auto value = coordinate->as_bigint();
+            limbs = std::copy( value.data, value.data + libff::alt_bn128_q_limbs, limbs );
+        }
+        auto key_id = key_ids.emplace( coordinates, keys.size() );
+        if ( key_id.second ) {
+            if ( !ThresholdUtils::ValidateKey( public_key ) ) {
+                throw ThresholdUtils::IsNotWellFormed( "Error, public key is not member of G2" );
+            }
+            keys.push_back( public_key );
+        }
+        entry_keys[i] = key_id.first->second;
+    }
+
+    // zero signature never verifies, so it does not go into the batch
+    std::vector< size_t > order;
+    for ( size_t i = 0; i < entries.size(); ++i ) {
+        if ( std::get< 1 >( entries[i] ).is_zero() ) {
+            failed.push_back( i );
+        } else {
+            order.push_back( i );
+        }
     }
 
-    libff::alt_bn128_G1 aggregated_sig = libff::alt_bn128_G1::zero();
-    for ( libff::alt_bn128_G1 sig : sign ) {
-        aggregated_sig = aggregated_sig + sig;
+    std::stable_sort( order.begin(), order.end(),
+        [&]( size_t lhs, size_t rhs ) { return entry_keys[lhs] < entry_keys[rhs]; } );
+
+    auto weights = ThresholdUtils::GenerateBatchWeights( order.size() );
+
+    std::vector< libff::alt_bn128_G1 > weighted_sigs( order.size() );
+    std::vector< libff::alt_bn128_G1 > weighted_hashes( order.size() );
+
+    ThresholdUtils::ParallelFor( order.size(), [&]( size_t begin, size_t end ) {
+        for ( size_t i = begin; i < end; ++i ) {
+            const auto& entry = entries[order[i]];
+            const libff::alt_bn128_G1& sign = std::get< 1 >( entry );
+
+            if ( !sign.is_well_formed() ) {
+                throw ThresholdUtils::IsNotWellFormed(
+                    "Error, signature does not lie on the alt_bn128 curve" );
+            }
+            if ( libff::alt_bn128_modulus_r * sign != libff::alt_bn128_G1::zero() ) {
+                throw ThresholdUtils::IsNotWellFormed( "Error, signature is not member of G1" );
+            }
+
+            weighted_sigs[i] = weights[i] * sign;
+            weighted_hashes[i] = weights[i] * ThresholdUtils::HashtoG1( std::get< 0 >( entry ) );
+        }
+    } );
+
+    std::vector< libff::alt_bn128_G1 > sign_prefix( order.size() + 1, libff::alt_bn128_G1::zero() );
+    std::vector< libff::alt_bn128_G1 > hash_prefix( order.size() + 1, libff::alt_bn128_G1::zero() );
+    // key_begin[k] is the first position of key k in order
+    std::vector< size_t > key_begin( keys.size() + 1, order.size() );
+
+    for ( size_t i = order.size(); i-- > 0; ) {
+        key_begin[entry_keys[order[i]]] = i;
+    }
+    for ( size_t k = keys.size(); k-- > 0; ) {
+        key_begin[k] = std::min( key_begin[k], key_begin[k + 1] );
     }
 
-    return ( libff::alt_bn128_ate_reduced_pairing( aggregated_sig, libff::alt_bn128_G2::one() ) ==
-             libff::alt_bn128_ate_reduced_pairing( aggregated_hash, public_key ) );
+    for ( size_t i = 0; i < order.size(); ++i ) {
+        sign_prefix[i + 1] = sign_prefix[i] + weighted_sigs[i];
+        hash_prefix[i + 1] = hash_prefix[i] + weighted_hashes[i];
+    }
+
+    std::vector< libff::alt_bn128_ate_G2_precomp > key_precomps;
+    key_precomps.reserve( keys.size() );
+    for ( auto& key : keys ) {
+        key_precomps.push_back( libff::alt_bn128_ate_precompute_G2( key ) );
+    }
+
+    auto check = [&]( size_t begin, size_t end ) {
+        std::vector< libff::alt_bn128_G1 > points = { sign_prefix[begin] - sign_prefix[end] };
+        std::vector< const libff::alt_bn128_ate_G2_precomp* > precomps = {
+            &ThresholdUtils::G2GeneratorPrecomp() };
+
+        for ( size_t k = 0; k < keys.size(); ++k ) {
+            size_t from = std::max( begin, key_begin[k] );
+            size_t to = std::min( end, key_begin[k + 1] );
+            if ( from < to ) {
+                points.push_back( hash_prefix[to] - hash_prefix[from] );
+                precomps.push_back( &key_precomps[k] );
+            }
+        }
+
+        libff::alt_bn128_Fq12 miller_loop = ThresholdUtils::MultiMillerLoop( points, precomps );
+
+        return libff::alt_bn128_final_exponentiation( miller_loop ) == libff::alt_bn128_GT::one();
+    };
+
+    if ( !order.empty() && !check( 0, order.size() ) ) {
+        std::vector< size_t > failed_positions;
+        ThresholdUtils::BisectFailedBatch( 0, order.size(), check, failed_positions );
+        for ( size_t position : failed_positions ) {
+            failed.push_back( order[position] );
+        }
+    }
+
+    std::sort( failed.begin(), failed.end() );
+
+    return failed;
 }
 
 std::pair< libff::alt_bn128_Fr, libff::alt_bn128_G2 > Bls::KeysRecover(
@@ -354,7 +554,7 @@ std::pair< libff::alt_bn128_Fr, libff::alt_bn128_G2 > Bls::KeysRecover(
     }
 
     const libff::alt_bn128_G2 public_key =
-        secret_key * libff::alt_bn128_G2::one();  // public key recovering
+        ThresholdUtils::mulGenerator( secret_key );  // public key recovering
 
     return std::make_pair( secret_key, public_key );
 }
@@ -365,24 +565,26 @@ libff::alt_bn128_G1 Bls::SignatureRecover( const std::vector< libff::alt_bn128_G
         throw ThresholdUtils::IncorrectInput( "not enough participants in the threshold group" );
     }
 
-    libff::alt_bn128_G1 sign = libff::alt_bn128_G1::zero();
-
     for ( size_t i = 0; i < this->t_; ++i ) {
         if ( !shares[i].is_well_formed() ) {
             throw ThresholdUtils::IsNotWellFormed( "incorrect input data to recover signature" );
         }
-        sign = sign + coeffs[i] * shares[i];  // signature recovering using Lagrange Coefficients
     }
 
+    // signature recovering using Lagrange Coefficients
+    libff::alt_bn128_G1 sign = ThresholdUtils::MultiScalarMul(
+        std::vector< libff::alt_bn128_Fr >( coeffs.begin(), coeffs.begin() + this->t_ ),
+        std::vector< libff::alt_bn128_G1 >( shares.begin(), shares.begin() + this->t_ ) );
+
     return sign;  // first element is hash of a receiving message
 }
 
 libff::alt_bn128_G1 Bls::PopProve( const libff::alt_bn128_Fr& secret_key ) {
-    libff::alt_bn128_G2 public_key = secret_key * libff::alt_bn128_G2::one();
+    libff::alt_bn128_G2 public_key = ThresholdUtils::mulGenerator( secret_key );
 
     libff::alt_bn128_G1 hash = HashPublicKeyToG1( public_key );
 
-    libff::alt_bn128_G1 ret = secret_key * hash;
+    libff::alt_bn128_G1 ret = ThresholdUtils::ConstantTimeMul( secret_key, hash );
 
     return ret;
 }
@@ -395,8 +597,7 @@ bool Bls::PopVerify( const libff::alt_bn128_G2& public_key, const libff::alt_bn1
 
     libff::alt_bn128_G1 hash = HashPublicKeyToG1( public_key );
 
-    return libff::alt_bn128_ate_reduced_pairing( hash, public_key ) ==
-           libff::alt_bn128_ate_reduced_pairing( prove, libff::alt_bn128_G2::one() );
+    return ThresholdUtils::CheckPairing( prove, hash, public_key );
 }
 
 }  // namespace libBLS
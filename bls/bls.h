@@ -26,9 +26,11 @@
 
 #include <third_party/cryptlite/sha256.h>
 
+#include <array>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <tuple>
 #include <utility>
 #include <vector>
 
@@ -39,6 +41,14 @@ static constexpr size_t BLS_MAX_SIG_LEN = 240;
 
 namespace libBLS {
 
+// signature or signature share together with the hint held by value, hintY and hintCounter are
+// the two parts of the string hint "y:counter"
+struct SigWithHint {
+    libff::alt_bn128_G1 sig;
+    libff::alt_bn128_Fq hintY;
+    uint64_t hintCounter;
+};
+
 class Bls {
 public:
     Bls( const size_t t, const size_t n );
@@ -62,6 +72,10 @@ public:
     static libff::alt_bn128_G1 Signing(
         const libff::alt_bn128_G1 hash, const libff::alt_bn128_Fr secret_key );
 
+    // neither this nor Verification for a hash passed by reference allocates memory
+    static SigWithHint Signing(
+        const std::array< uint8_t, 32 >& hash_byte_arr, const libff::alt_bn128_Fr& secret_key );
+
     static libff::alt_bn128_G1 CoreSignAggregated(
         const std::string& message, const libff::alt_bn128_Fr secret_key );
 
@@ -79,10 +93,26 @@ public:
     static bool Verification( std::shared_ptr< std::array< uint8_t, 32 > >,
         const libff::alt_bn128_G1 sign, const libff::alt_bn128_G2 public_key );
 
+    static bool Verification( std::shared_ptr< std::array< uint8_t, 32 > >,
+        const libff::alt_bn128_G1 sign, const libff::alt_bn128_G2 public_key,
+        const libff::alt_bn128_ate_G2_precomp& public_key_precomp );
+
+    static bool Verification( const std::array< uint8_t, 32 >& hash_byte_arr,
+        const libff::alt_bn128_G1& sign, const libff::alt_bn128_G2& public_key,
+        const libff::alt_bn128_ate_G2_precomp& public_key_precomp );
+
+    static std::vector< size_t > BatchVerifySameHash( const libff::alt_bn128_G1& hash,
+        const std::vector< libff::alt_bn128_G1 >& signs,
+        const std::vector< libff::alt_bn128_G2 >& public_keys );
+
     static bool AggregatedVerification(
         std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > hash_byte_arr,
         const std::vector< libff::alt_bn128_G1 > sign, const libff::alt_bn128_G2 public_key );
 
+    static std::vector< size_t > BatchVerify(
+        const std::vector< std::tuple< std::shared_ptr< std::array< uint8_t, 32 > >,
+            libff::alt_bn128_G1, libff::alt_bn128_G2 > >& entries );
+
     std::pair< libff::alt_bn128_Fr, libff::alt_bn128_G2 > KeysRecover(
         const std::vector< libff::alt_bn128_Fr >& coeffs,
         const std::vector< libff::alt_bn128_Fr >& shares );
@@ -27,10 +27,11 @@
 #include <tools/utils.h>
 
 DKGBLSSecret::DKGBLSSecret( size_t _requiredSigners, size_t _totalSigners )
-    : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
+    : requiredSigners( _requiredSigners ),
+      totalSigners( _totalSigners ),
+      dkg( _requiredSigners, _totalSigners ) {
     libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
 
-    libBLS::Dkg dkg( requiredSigners, totalSigners );
     poly = dkg.GeneratePolynomial();
 }
 
@@ -39,16 +40,19 @@ void DKGBLSSecret::setPoly( std::vector< libff::alt_bn128_Fr > _poly ) {
         throw libBLS::ThresholdUtils::IncorrectInput( "Wrong size of vector" );
     }
     poly = _poly;
+    public_shares.clear();
 }
 
 std::vector< libff::alt_bn128_Fr > DKGBLSSecret::getDKGBLSSecretShares() {
-    libBLS::Dkg dkg( requiredSigners, totalSigners );
     return dkg.SecretKeyContribution( poly );
 }
 
 std::vector< libff::alt_bn128_G2 > DKGBLSSecret::getDKGBLSPublicShares() {
-    libBLS::Dkg dkg( requiredSigners, totalSigners );
-    return dkg.VerificationVector( poly );
+    if ( public_shares.empty() ) {
+        public_shares = dkg.VerificationVector( poly );
+    }
+
+    return public_shares;
 }
 
 libff::alt_bn128_Fr DKGBLSSecret::getValueAt0() {
@@ -25,12 +25,16 @@
 #define LIBBLS_DKGBLSSECRET_H
 
 #include <bls/bls.h>
+#include <dkg/dkg.h>
 
 class DKGBLSSecret {
 private:
     size_t requiredSigners;
     size_t totalSigners;
+    libBLS::Dkg dkg;
     std::vector< libff::alt_bn128_Fr > poly;
+    // verification vector of poly, empty until it is requested after the last setPoly
+    std::vector< libff::alt_bn128_G2 > public_shares;
 
 public:
     DKGBLSSecret( size_t _requiredSigners, size_t _totalSigners );
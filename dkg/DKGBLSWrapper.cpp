@@ -44,8 +44,17 @@ bool DKGBLSWrapper::VerifyDKGShare( size_t _signerIndex, const libff::alt_bn128_
     }
     if ( _verification_vector->size() != requiredSigners )
         throw libBLS::ThresholdUtils::IncorrectInput( "Wrong vector size" );
-    libBLS::Dkg dkg( requiredSigners, totalSigners );
-    return dkg.Verification( _signerIndex, _share, *_verification_vector );
+    return VerifyDKGShare(
+        _signerIndex, _share, libBLS::VerificationVector( *_verification_vector ) );
+}
+
+bool DKGBLSWrapper::VerifyDKGShare( size_t _signerIndex, const libff::alt_bn128_Fr& _share,
+    const libBLS::VerificationVector& _verification_vector ) {
+    if ( _share.is_zero() )
+        throw libBLS::ThresholdUtils::ZeroSecretKey( " Zero secret share" );
+    if ( _verification_vector.size() != requiredSigners )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong vector size" );
+    return _verification_vector.verify( _signerIndex, _share );
 }
 
 void DKGBLSWrapper::setDKGSecret(
@@ -80,6 +89,24 @@ BLSPrivateKeyShare DKGBLSWrapper::CreateBLSPrivateKeyShare(
     return BLSPrivateKeyShare( skey_share, requiredSigners, totalSigners );
 }
 
+BLSPrivateKeyShare DKGBLSWrapper::CreateBLSPrivateKeyShare(
+    const libBLS::DkgAccumulator& accumulator ) {
+    if ( accumulator.getT() != requiredSigners || accumulator.getN() != totalSigners )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong parameters of accumulator" );
+
+    return BLSPrivateKeyShare( accumulator.getSecretKeyShare(), requiredSigners, totalSigners );
+}
+
+BLSPublicKey DKGBLSWrapper::CreateBLSPublicKey( const libBLS::DkgAccumulator& accumulator,
+    size_t _requiredSigners, size_t _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    if ( accumulator.getT() != _requiredSigners || accumulator.getN() != _totalSigners )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong parameters of accumulator" );
+
+    return BLSPublicKey( accumulator.getCommonPublicKey(), _requiredSigners, _totalSigners );
+}
+
 libff::alt_bn128_Fr DKGBLSWrapper::getValueAt0() {
     return dkg_secret_ptr->getValueAt0();
 }
@@ -26,6 +26,8 @@
 
 #include <bls/BLSPrivateKeyShare.h>
 #include <dkg/DKGBLSSecret.h>
+#include <dkg/DkgAccumulator.h>
+#include <dkg/VerificationVector.h>
 
 
 class DKGBLSWrapper {
@@ -41,6 +43,10 @@ public:
     bool VerifyDKGShare( size_t signerIndex, const libff::alt_bn128_Fr& share,
         std::shared_ptr< std::vector< libff::alt_bn128_G2 > > _verification_vector );
 
+    // checks the same commitments against many shares without validating them again
+    bool VerifyDKGShare( size_t signerIndex, const libff::alt_bn128_Fr& share,
+        const libBLS::VerificationVector& verification_vector );
+
     void setDKGSecret( std::shared_ptr< std::vector< libff::alt_bn128_Fr > > _poly_ptr );
 
     std::shared_ptr< std::vector< libff::alt_bn128_Fr > > createDKGSecretShares();
@@ -50,6 +56,12 @@ public:
     BLSPrivateKeyShare CreateBLSPrivateKeyShare(
         std::shared_ptr< std::vector< libff::alt_bn128_Fr > > secret_shares_ptr );
 
+    // keys of a round whose dealers were verified and summed as they arrived
+    BLSPrivateKeyShare CreateBLSPrivateKeyShare( const libBLS::DkgAccumulator& accumulator );
+
+    static BLSPublicKey CreateBLSPublicKey( const libBLS::DkgAccumulator& accumulator,
+        size_t _requiredSigners, size_t _totalSigners );
+
     libff::alt_bn128_Fr getValueAt0();
 
     static BLSPublicKey CreateTEPublicKey(
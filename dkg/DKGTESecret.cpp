@@ -28,13 +28,14 @@
 #include <dkg/dkg.h>
 
 DKGTESecret::DKGTESecret( size_t _requiredSigners, size_t _totalSigners )
-    : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
+    : requiredSigners( _requiredSigners ),
+      totalSigners( _totalSigners ),
+      dkg( _requiredSigners, _totalSigners ) {
     libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
-    libBLS::Dkg dkg_te( requiredSigners, totalSigners );
-    poly = dkg_te.GeneratePolynomial();
+    poly = dkg.GeneratePolynomial();
 }
 
 void DKGTESecret::setPoly( std::vector< libff::alt_bn128_Fr >& _poly ) {
@@ -43,14 +44,17 @@ void DKGTESecret::setPoly( std::vector< libff::alt_bn128_Fr >& _poly ) {
     }
 
     poly = _poly;
+    public_shares.clear();
 }
 
 std::vector< libff::alt_bn128_Fr > DKGTESecret::getDKGTESecretShares() {
-    libBLS::Dkg dkg_te( requiredSigners, totalSigners );
-    return dkg_te.SecretKeyContribution( poly );
+    return dkg.SecretKeyContribution( poly );
 }
 
 std::vector< libff::alt_bn128_G2 > DKGTESecret::getDKGTEPublicShares() {
-    libBLS::Dkg dkg_te( requiredSigners, totalSigners );
-    return dkg_te.VerificationVector( poly );
+    if ( public_shares.empty() ) {
+        public_shares = dkg.VerificationVector( poly );
+    }
+
+    return public_shares;
 }
@@ -25,13 +25,17 @@
 #ifndef LIBBLS_DKGTESECRET_H
 #define LIBBLS_DKGTESECRET_H
 
+#include <dkg/dkg.h>
 #include <threshold_encryption/threshold_encryption.h>
 
 class DKGTESecret {
 private:
     size_t requiredSigners;
     size_t totalSigners;
+    libBLS::Dkg dkg;
     std::vector< libff::alt_bn128_Fr > poly;
+    // verification vector of poly, empty until it is requested after the last setPoly
+    std::vector< libff::alt_bn128_G2 > public_shares;
 
 public:
     DKGTESecret( size_t _requiredSigners, size_t _totalSigners );
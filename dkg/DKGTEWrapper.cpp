@@ -29,7 +29,7 @@ DKGTEWrapper::DKGTEWrapper( size_t _requiredSigners, size_t _totalSigners )
     : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
     libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     DKGTESecret temp( _requiredSigners, _totalSigners );
     dkg_secret_ptr = std::make_shared< DKGTESecret >( temp );
@@ -43,8 +43,17 @@ bool DKGTEWrapper::VerifyDKGShare( size_t _signerIndex, const libff::alt_bn128_F
         throw libBLS::ThresholdUtils::IncorrectInput( "Null verification vector" );
     if ( _verification_vector->size() != requiredSigners )
         throw libBLS::ThresholdUtils::IncorrectInput( "Wrong size of verification vector" );
-    libBLS::Dkg dkg_te( requiredSigners, totalSigners );
-    return dkg_te.Verification( _signerIndex, _share, *_verification_vector );
+    return VerifyDKGShare(
+        _signerIndex, _share, libBLS::VerificationVector( *_verification_vector ) );
+}
+
+bool DKGTEWrapper::VerifyDKGShare( size_t _signerIndex, const libff::alt_bn128_Fr& _share,
+    const libBLS::VerificationVector& _verification_vector ) {
+    if ( _share.is_zero() )
+        throw libBLS::ThresholdUtils::ZeroSecretKey( "Zero secret share" );
+    if ( _verification_vector.size() != requiredSigners )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong size of verification vector" );
+    return _verification_vector.verify( _signerIndex, _share );
 }
 
 void DKGTEWrapper::setDKGSecret( std::shared_ptr< std::vector< libff::alt_bn128_Fr > > _poly_ptr ) {
@@ -96,3 +105,22 @@ TEPublicKey DKGTEWrapper::CreateTEPublicKey(
 
     return common_public;
 }
+
+TEPrivateKeyShare DKGTEWrapper::CreateTEPrivateKeyShare(
+    const libBLS::DkgAccumulator& accumulator ) {
+    if ( accumulator.getT() != requiredSigners || accumulator.getN() != totalSigners )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong parameters of accumulator" );
+
+    return TEPrivateKeyShare( accumulator.getSecretKeyShare(), accumulator.getIndex() + 1,
+        requiredSigners, totalSigners );
+}
+
+TEPublicKey DKGTEWrapper::CreateTEPublicKey( const libBLS::DkgAccumulator& accumulator,
+    size_t _requiredSigners, size_t _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    if ( accumulator.getT() != _requiredSigners || accumulator.getN() != _totalSigners )
+        throw libBLS::ThresholdUtils::IncorrectInput( "Wrong parameters of accumulator" );
+
+    return TEPublicKey( accumulator.getCommonPublicKey(), _requiredSigners, _totalSigners );
+}
@@ -26,6 +26,7 @@
 #define LIBBLS_DKGTEWRAPPER_H
 
 #include <dkg/DKGTESecret.h>
+#include <dkg/DkgAccumulator.h>
 #include <dkg/dkg.h>
 #include <threshold_encryption/TEPrivateKeyShare.h>
 
@@ -42,6 +43,10 @@ public:
     bool VerifyDKGShare( size_t signerIndex, const libff::alt_bn128_Fr& share,
         std::shared_ptr< std::vector< libff::alt_bn128_G2 > > verification_vector );
 
+    // checks the same commitments against many shares without validating them again
+    bool VerifyDKGShare( size_t signerIndex, const libff::alt_bn128_Fr& share,
+        const libBLS::VerificationVector& verification_vector );
+
     void setDKGSecret( std::shared_ptr< std::vector< libff::alt_bn128_Fr > > _poly_ptr );
 
     std::shared_ptr< std::vector< libff::alt_bn128_Fr > > createDKGSecretShares();
@@ -54,6 +59,12 @@ public:
     static TEPublicKey CreateTEPublicKey(
         std::shared_ptr< std::vector< std::vector< libff::alt_bn128_G2 > > > public_shares_all,
         size_t _requiredSigners, size_t _totalSigners );
+
+    // keys of a round whose dealers were verified and summed as they arrived
+    TEPrivateKeyShare CreateTEPrivateKeyShare( const libBLS::DkgAccumulator& accumulator );
+
+    static TEPublicKey CreateTEPublicKey( const libBLS::DkgAccumulator& accumulator,
+        size_t _requiredSigners, size_t _totalSigners );
 };
 
 
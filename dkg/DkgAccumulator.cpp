@@ -0,0 +1,185 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+
+  @file DkgAccumulator.cpp
+  @author SKALE Labs
+  @date 2026
+*/
+
+#include <dkg/DkgAccumulator.h>
+#include <dkg/VerificationVector.h>
+#include <tools/utils.h>
+
+#include <third_party/cryptlite/sha256.h>
+
+namespace libBLS {
+
+DkgAccumulator::DkgAccumulator( size_t idx, size_t t, size_t n )
+    : idx_( idx ),
+      t_( t ),
+      n_( n ),
+      dealers_( n ),
+      digests_( n ),
+      secret_key_share_( libff::alt_bn128_Fr::zero() ),
+      aggregate_( t, libff::alt_bn128_G2::zero() ) {
+    ThresholdUtils::checkSigners( t, n );
+
+    if ( idx >= n ) {
+        throw ThresholdUtils::IncorrectInput( "Wrong index of the node" );
+    }
+}
+
+void DkgAccumulator::checkDealer(
+    size_t dealer, const std::vector< libff::alt_bn128_G2 >& verification_vector ) const {
+    if ( dealer >= n_ ) {
+        throw ThresholdUtils::IncorrectInput( "Wrong index of the dealer" );
+    }
+    if ( verification_vector.size() != t_ ) {
+        throw ThresholdUtils::IncorrectInput( "Wrong size of verification vector" );
+    }
+}
+
+DkgAccumulator::Digest DkgAccumulator::getDigest( const libff::alt_bn128_Fr& share,
+    const std::vector< libff::alt_bn128_G2 >& verification_vector ) {
+    std::string serialized;
+    serialized.reserve( BLS_FR_BYTES + verification_vector.size() * BLS_G2_BYTES );
+
+    auto share_bytes = ThresholdUtils::FrToBytes( share );
+    serialized.append( share_bytes.begin(), share_bytes.end() );
+    for ( const auto& coeff : verification_vector ) {
+        auto coeff_bytes = ThresholdUtils::G2ToBytes( coeff );
+        serialized.append( coeff_bytes.begin(), coeff_bytes.end() );
+    }
+
+    Digest digest;
+    cryptlite::sha256::hash( serialized, digest.data() );
+    return digest;
+}
+
+bool DkgAccumulator::addDealer( size_t dealer, const libff::alt_bn128_Fr& share,
+    const std::vector< libff::alt_bn128_G2 >& verification_vector ) {
+    checkDealer( dealer, verification_vector );
+
+    // the expensive verification runs outside of the lock, so dealers are verified in parallel
+    if ( !VerificationVector( verification_vector ).verify( idx_, share ) ) {
+        return false;
+    }
+    Digest digest = getDigest( share, verification_vector );
+
+    std::lock_guard< std::mutex > lock( mutex_ );
+
+    if ( dealers_[dealer] ) {
+        throw ThresholdUtils::IncorrectInput( "Dealer is already added" );
+    }
+
+    dealers_[dealer] = true;
+    digests_[dealer] = digest;
+    ++dealers_count_;
+    secret_key_share_ += share;
+    for ( size_t i = 0; i < t_; ++i ) {
+        aggregate_[i] = aggregate_[i] + verification_vector[i];
+    }
+
+    return true;
+}
+
+void DkgAccumulator::removeDealer( size_t dealer, const libff::alt_bn128_Fr& share,
+    const std::vector< libff::alt_bn128_G2 >& verification_vector ) {
+    checkDealer( dealer, verification_vector );
+
+    // the digest matches only the exact share and verification vector verified in addDealer
+    Digest digest = getDigest( share, verification_vector );
+
+    std::lock_guard< std::mutex > lock( mutex_ );
+
+    if ( !dealers_[dealer] ) {
+        throw ThresholdUtils::IncorrectInput( "Dealer is not added" );
+    }
+    if ( digests_[dealer] != digest ) {
+        throw ThresholdUtils::IncorrectInput(
+            "Share or verification vector differ from the ones the dealer was added with" );
+    }
+
+    dealers_[dealer] = false;
+    --dealers_count_;
+    secret_key_share_ -= share;
+    for ( size_t i = 0; i < t_; ++i ) {
+        aggregate_[i] = aggregate_[i] - verification_vector[i];
+    }
+}
+
+size_t DkgAccumulator::getIndex() const {
+    return idx_;
+}
+
+size_t DkgAccumulator::getT() const {
+    return t_;
+}
+
+size_t DkgAccumulator::getN() const {
+    return n_;
+}
+
+bool DkgAccumulator::hasDealer( size_t dealer ) const {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    return dealer < n_ && dealers_[dealer];
+}
+
+size_t DkgAccumulator::getDealersCount() const {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    return dealers_count_;
+}
+
+libff::alt_bn128_Fr DkgAccumulator::getSecretKeyShare() const {
+    std::lock_guard< std::mutex > lock( mutex_ );
+
+    if ( dealers_count_ == 0 ) {
+        throw ThresholdUtils::IncorrectInput( "No dealers were added" );
+    }
+    if ( secret_key_share_.is_zero() ) {
+        throw std::logic_error( "Error, at least one secret key share is equal to zero" );
+    }
+
+    return secret_key_share_;
+}
+
+std::vector< libff::alt_bn128_G2 > DkgAccumulator::getAggregateVerificationVector() const {
+    std::lock_guard< std::mutex > lock( mutex_ );
+    return aggregate_;
+}
+
+libff::alt_bn128_G2 DkgAccumulator::getCommonPublicKey() const {
+    std::lock_guard< std::mutex > lock( mutex_ );
+
+    if ( dealers_count_ == 0 ) {
+        throw ThresholdUtils::IncorrectInput( "No dealers were added" );
+    }
+
+    return aggregate_[0];
+}
+
+libff::alt_bn128_G2 DkgAccumulator::getPublicKeyShare( size_t idx ) const {
+    if ( idx >= n_ ) {
+        throw ThresholdUtils::IncorrectInput( "Wrong index of the node" );
+    }
+
+    return VerificationVector::evaluate( getAggregateVerificationVector(), idx );
+}
+
+}  // namespace libBLS
@@ -0,0 +1,103 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+
+  @file DkgAccumulator.h
+  @author SKALE Labs
+  @date 2026
+*/
+
+#pragma once
+
+#include <array>
+#include <mutex>
+#include <vector>
+
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+
+namespace libBLS {
+
+// DKG round of the idx-th node as running sums over the dealers accepted so far, every
+// dealer's share and verification vector is verified and added as soon as it arrives, so
+// only O( t ) is kept and the keys are ready without any work once the qualified set is known.
+// A digest of what every dealer was added with is kept to check its removal.
+// Dealers may be added and removed from several threads at once
+class DkgAccumulator {
+public:
+    DkgAccumulator( size_t idx, size_t t, size_t n );
+
+    // verifies the share of a dealer against its verification vector and adds both to the
+    // sums, returns false and leaves the sums as they are if they do not correspond
+    bool addDealer( size_t dealer, const libff::alt_bn128_Fr& share,
+        const std::vector< libff::alt_bn128_G2 >& verification_vector );
+
+    // takes an accepted dealer out of the qualified set, throws if share and verification
+    // vector are not the ones it was added with
+    void removeDealer( size_t dealer, const libff::alt_bn128_Fr& share,
+        const std::vector< libff::alt_bn128_G2 >& verification_vector );
+
+    size_t getIndex() const;
+
+    size_t getT() const;
+
+    size_t getN() const;
+
+    bool hasDealer( size_t dealer ) const;
+
+    size_t getDealersCount() const;
+
+    // sum of the shares of the accepted dealers
+    libff::alt_bn128_Fr getSecretKeyShare() const;
+
+    // coefficient-wise sum of the verification vectors of the accepted dealers
+    std::vector< libff::alt_bn128_G2 > getAggregateVerificationVector() const;
+
+    libff::alt_bn128_G2 getCommonPublicKey() const;
+
+    // public key share of any node of the group from the aggregate verification vector
+    libff::alt_bn128_G2 getPublicKeyShare( size_t idx ) const;
+
+private:
+    typedef std::array< uint8_t, 32 > Digest;
+
+    void checkDealer(
+        size_t dealer, const std::vector< libff::alt_bn128_G2 >& verification_vector ) const;
+
+    static Digest getDigest( const libff::alt_bn128_Fr& share,
+        const std::vector< libff::alt_bn128_G2 >& verification_vector );
+
+    const size_t idx_;
+
+    const size_t t_;
+
+    const size_t n_;
+
+    mutable std::mutex mutex_;
+
+    std::vector< bool > dealers_;
+
+    std::vector< Digest > digests_;
+
+    size_t dealers_count_ = 0;
+
+    libff::alt_bn128_Fr secret_key_share_;
+
+    std::vector< libff::alt_bn128_G2 > aggregate_;
+};
+
+}  // namespace libBLS
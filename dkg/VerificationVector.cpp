@@ -0,0 +1,77 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+
+  @file VerificationVector.cpp
+  @author SKALE Labs
+  @date 2026
+*/
+
+#include <dkg/VerificationVector.h>
+#include <tools/utils.h>
+
+namespace libBLS {
+
+VerificationVector::VerificationVector( const std::vector< libff::alt_bn128_G2 >& commitments )
+    : commitments_( commitments ) {
+    ThresholdUtils::initCurve();
+
+    is_valid_ = !commitments_.empty();
+    for ( const auto& commitment : commitments_ ) {
+        if ( !ThresholdUtils::ValidateKey( commitment ) ) {
+            is_valid_ = false;
+            break;
+        }
+    }
+}
+
+bool VerificationVector::isValid() const {
+    return is_valid_;
+}
+
+size_t VerificationVector::size() const {
+    return commitments_.size();
+}
+
+const std::vector< libff::alt_bn128_G2 >& VerificationVector::getCommitments() const {
+    return commitments_;
+}
+
+libff::alt_bn128_G2 VerificationVector::evaluate( size_t idx ) const {
+    return evaluate( commitments_, idx );
+}
+
+libff::alt_bn128_G2 VerificationVector::evaluate(
+    const std::vector< libff::alt_bn128_G2 >& commitments, size_t idx ) {
+    // Horner's rule, every step multiplies by the small index of the node instead of a full
+    // 254 bit power of it
+    const libff::bigint< 1 > point( idx + 1 );
+
+    libff::alt_bn128_G2 value = libff::alt_bn128_G2::zero();
+    for ( size_t i = commitments.size(); i-- > 0; ) {
+        value = point * value + commitments[i];
+    }
+
+    return value;
+}
+
+bool VerificationVector::verify( size_t idx, const libff::alt_bn128_Fr& share ) const {
+    return is_valid_ && evaluate( idx ) == ThresholdUtils::mulGenerator( share );
+}
+
+}  // namespace libBLS
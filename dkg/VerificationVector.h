@@ -0,0 +1,61 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+
+  @file VerificationVector.h
+  @author SKALE Labs
+  @date 2026
+*/
+
+#pragma once
+
+#include <vector>
+
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
+
+namespace libBLS {
+
+// commitments g2 * a_i to the coefficients of a dealer's polynomial, the subgroup membership
+// of all of them is checked once on construction, so the same vector is checked against the
+// shares of every node for the cost of evaluating it
+class VerificationVector {
+public:
+    explicit VerificationVector( const std::vector< libff::alt_bn128_G2 >& commitments );
+
+    bool isValid() const;
+
+    size_t size() const;
+
+    const std::vector< libff::alt_bn128_G2 >& getCommitments() const;
+
+    // sum( ( idx + 1 )^i * commitments[i] ), the public counterpart of the idx-th node's share
+    libff::alt_bn128_G2 evaluate( size_t idx ) const;
+
+    static libff::alt_bn128_G2 evaluate(
+        const std::vector< libff::alt_bn128_G2 >& commitments, size_t idx );
+
+    // idx-th node verifies that share corresponds to this vector
+    bool verify( size_t idx, const libff::alt_bn128_Fr& share ) const;
+
+private:
+    std::vector< libff::alt_bn128_G2 > commitments_;
+
+    bool is_valid_ = false;
+};
+
+}  // namespace libBLS
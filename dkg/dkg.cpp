@@ -32,6 +32,22 @@ namespace libBLS {
 
 typedef std::vector< libff::alt_bn128_Fr > Polynomial;
 
+namespace {
+
+// value of the first t coefficients of pol at point by Horner's rule, t multiplications
+// instead of 2t with the powers of point
+libff::alt_bn128_Fr EvaluatePolynomial(
+    const Polynomial& pol, size_t t, const libff::alt_bn128_Fr& point ) {
+    libff::alt_bn128_Fr value = libff::alt_bn128_Fr::zero();
+    for ( size_t i = t; i-- > 0; ) {
+        value = value * point + pol[i];
+    }
+
+    return value;
+}
+
+}  // namespace
+
 Dkg::Dkg( const size_t t, const size_t n ) : t_( t ), n_( n ) {
     ThresholdUtils::initCurve();
 }
@@ -54,38 +70,51 @@ Polynomial Dkg::GeneratePolynomial() {
 std::vector< libff::alt_bn128_G2 > Dkg::VerificationVector(
     const std::vector< libff::alt_bn128_Fr >& polynomial ) {
     // vector of public values that each node will broadcast
+    // every coefficient is multiplied with the same fixed-base table of the generator
     std::vector< libff::alt_bn128_G2 > verification_vector( this->t_ );
-    for ( size_t i = 0; i < this->t_; ++i ) {
-        verification_vector[i] = polynomial[i] * libff::alt_bn128_G2::one();
-    }
+    ThresholdUtils::ParallelFor( this->t_, [&]( size_t begin, size_t end ) {
+        for ( size_t i = begin; i < end; ++i ) {
+            verification_vector[i] = ThresholdUtils::mulGenerator( polynomial[i] );
+        }
+    } );
 
     return verification_vector;
 }
 
 libff::alt_bn128_Fr Dkg::PolynomialValue( const Polynomial& pol, libff::alt_bn128_Fr point ) {
     // calculate value of polynomial in a random integer point
-    libff::alt_bn128_Fr value = libff::alt_bn128_Fr::zero();
-
-    libff::alt_bn128_Fr pow = libff::alt_bn128_Fr::one();
-    for ( size_t i = 0; i < this->t_; ++i ) {
-        if ( i == this->t_ - 1 && pol[i] == libff::alt_bn128_Fr::zero() ) {
-            throw std::logic_error( "Error, incorrect degree of a polynomial" );
-        }
-        value += pol[i] * pow;
-        pow *= point;
+    if ( pol.size() < this->t_ ) {
+        throw ThresholdUtils::IncorrectInput( "Wrong size of polynomial" );
+    }
+    if ( pol[this->t_ - 1] == libff::alt_bn128_Fr::zero() ) {
+        throw std::logic_error( "Error, incorrect degree of a polynomial" );
     }
 
-    return value;
+    return EvaluatePolynomial( pol, this->t_, point );
 }
 
 std::vector< libff::alt_bn128_Fr > Dkg::SecretKeyContribution(
     const std::vector< libff::alt_bn128_Fr >& polynomial ) {
     // calculate for each node a list of secret values that will be used for verification
-    std::vector< libff::alt_bn128_Fr > secret_key_contribution( this->n_ );
-    for ( size_t i = 0; i < this->n_; ++i ) {
-        secret_key_contribution[i] = PolynomialValue( polynomial, libff::alt_bn128_Fr( i + 1 ) );
+    if ( polynomial.size() < this->t_ ) {
+        throw ThresholdUtils::IncorrectInput( "Wrong size of polynomial" );
+    }
+    if ( polynomial[this->t_ - 1] == libff::alt_bn128_Fr::zero() ) {
+        throw std::logic_error( "Error, incorrect degree of a polynomial" );
     }
 
+    // every value takes t multiplications, small rounds are evaluated on this thread
+    std::vector< libff::alt_bn128_Fr > secret_key_contribution( this->n_ );
+    ThresholdUtils::ParallelFor(
+        this->n_,
+        [&]( size_t begin, size_t end ) {
+            for ( size_t i = begin; i < end; ++i ) {
+                secret_key_contribution[i] =
+                    EvaluatePolynomial( polynomial, this->t_, libff::alt_bn128_Fr( i + 1 ) );
+            }
+        },
+        ( PARALLEL_MIN_FR_MULS + this->t_ - 1 ) / this->t_ );
+
     return secret_key_contribution;
 }
 
@@ -108,19 +137,136 @@ libff::alt_bn128_Fr Dkg::SecretKeyShareCreate(
 bool Dkg::Verification( size_t idx, libff::alt_bn128_Fr share,
     const std::vector< libff::alt_bn128_G2 >& verification_vector ) {
     // idx-th node verifies that share corresponds to the verification vector
-    libff::alt_bn128_G2 value = libff::alt_bn128_G2::zero();
-    for ( size_t i = 0; i < this->t_; ++i ) {
-        if ( !ThresholdUtils::ValidateKey( verification_vector[i] ) ) {
-            return false;
+    if ( verification_vector.size() < this->t_ ) {
+        return false;
+    }
+
+    return libBLS::VerificationVector( std::vector< libff::alt_bn128_G2 >(
+                                           verification_vector.begin(),
+                                           verification_vector.begin() + this->t_ ) )
+        .verify( idx, share );
+}
+
+bool Dkg::Verification(
+    size_t idx, const libff::alt_bn128_Fr& share, const libBLS::VerificationVector& commitments ) {
+    return commitments.size() == this->t_ && commitments.verify( idx, share );
+}
+
+std::vector< size_t > Dkg::VerifyAll( size_t idx, const std::vector< libff::alt_bn128_Fr >& shares,
+    const std::vector< std::vector< libff::alt_bn128_G2 > >& verification_vectors ) {
+    if ( shares.size() != verification_vectors.size() ) {
+        throw ThresholdUtils::IncorrectInput( "Number of shares and verification vectors differ" );
+    }
+
+    std::vector< size_t > failed;
+    std::vector< char > is_valid( shares.size() );
+    std::vector< libff::alt_bn128_G2 > values( shares.size() );
+
+    ThresholdUtils::ParallelFor( shares.size(), [&]( size_t begin, size_t end ) {
+        for ( size_t j = begin; j < end; ++j ) {
+            if ( verification_vectors[j].size() < this->t_ ) {
+                is_valid[j] = false;
+                continue;
+            }
+
+            libBLS::VerificationVector commitments( std::vector< libff::alt_bn128_G2 >(
+                verification_vectors[j].begin(), verification_vectors[j].begin() + this->t_ ) );
+            is_valid[j] = commitments.isValid();
+            if ( is_valid[j] ) {
+                values[j] = commitments.evaluate( idx );
+            }
+        }
+    } );
+
+    // dealers with malformed commitments fail on their own and take no part in the batch
+    std::vector< size_t > dealers;
+    for ( size_t j = 0; j < shares.size(); ++j ) {
+        if ( is_valid[j] ) {
+            dealers.push_back( j );
+        } else {
+            failed.push_back( j );
+        }
+    }
+
+    // sum( r_j * s_j ) * g2 == sum( r_j * value_j ) for random r_j holds with overwhelming
+    // probability only if s_j * g2 == value_j holds for every dealer j
+    auto weights = ThresholdUtils::GenerateBatchWeights( dealers.size() );
+
+    std::vector< libff::alt_bn128_Fr > weighted_shares( dealers.size() );
+    for ( size_t k = 0; k < dealers.size(); ++k ) {
+        libff::bigint< libff::alt_bn128_r_limbs > weight;
+        std::copy( weights[k].data, weights[k].data + BATCH_WEIGHT_LIMBS, weight.data );
+        weighted_shares[k] = libff::alt_bn128_Fr( weight ) * shares[dealers[k]];
+    }
+
+    auto check = [&]( size_t begin, size_t end ) {
+        libff::alt_bn128_Fr share_sum = libff::alt_bn128_Fr::zero();
+        std::vector< libff::bigint< BATCH_WEIGHT_LIMBS > > range_weights;
+        std::vector< libff::alt_bn128_G2 > range_values;
+        for ( size_t k = begin; k < end; ++k ) {
+            share_sum += weighted_shares[k];
+            range_weights.push_back( weights[k] );
+            range_values.push_back( values[dealers[k]] );
+        }
+
+        return ThresholdUtils::mulGenerator( share_sum ) ==
+               ThresholdUtils::MultiScalarMul( range_weights, range_values );
+    };
+
+    if ( !dealers.empty() && !check( 0, dealers.size() ) ) {
+        std::vector< size_t > failed_positions;
+        ThresholdUtils::BisectFailedBatch( 0, dealers.size(), check, failed_positions );
+        for ( size_t k : failed_positions ) {
+            failed.push_back( dealers[k] );
+        }
+        std::sort( failed.begin(), failed.end() );
+    }
+
+    return failed;
+}
+
+std::vector< libff::alt_bn128_G2 > Dkg::AggregateVerificationVectors(
+    const std::vector< std::vector< libff::alt_bn128_G2 > >& verification_vectors ) {
+    if ( verification_vectors.size() != this->n_ ) {
+        throw ThresholdUtils::IncorrectInput( "Wrong number of verification vectors" );
+    }
+    for ( const auto& verification_vector : verification_vectors ) {
+        if ( verification_vector.size() != this->t_ ) {
+            throw ThresholdUtils::IncorrectInput( "Wrong size of verification vector" );
         }
-        value = value + power( libff::alt_bn128_Fr( idx + 1 ), i ) * verification_vector[i];
     }
 
-    return ( value == share * libff::alt_bn128_G2::one() );
+    std::vector< libff::alt_bn128_G2 > aggregate( this->t_, libff::alt_bn128_G2::zero() );
+    ThresholdUtils::ParallelFor( this->t_, [&]( size_t begin, size_t end ) {
+        for ( size_t i = begin; i < end; ++i ) {
+            for ( const auto& verification_vector : verification_vectors ) {
+                aggregate[i] = aggregate[i] + verification_vector[i];
+            }
+        }
+    } );
+
+    return aggregate;
+}
+
+std::pair< libff::alt_bn128_G2, std::vector< libff::alt_bn128_G2 > > Dkg::PublicKeyShares(
+    const std::vector< std::vector< libff::alt_bn128_G2 > >& verification_vectors ) {
+    // the sum of all polynomials is evaluated once per node instead of every polynomial,
+    // n * t instead of n * n * t steps of Horner's rule with the small index of the node
+    std::vector< libff::alt_bn128_G2 > aggregate =
+        AggregateVerificationVectors( verification_vectors );
+
+    std::vector< libff::alt_bn128_G2 > public_key_shares( this->n_ );
+    ThresholdUtils::ParallelFor( this->n_, [&]( size_t begin, size_t end ) {
+        for ( size_t i = begin; i < end; ++i ) {
+            public_key_shares[i] = libBLS::VerificationVector::evaluate( aggregate, i );
+        }
+    } );
+
+    return { aggregate[0], public_key_shares };
 }
 
 libff::alt_bn128_G2 Dkg::GetPublicKeyFromSecretKey( const libff::alt_bn128_Fr& secret_key ) {
-    libff::alt_bn128_G2 public_key = secret_key * libff::alt_bn128_G2::one();
+    libff::alt_bn128_G2 public_key = ThresholdUtils::mulGenerator( secret_key );
     public_key.to_affine_coordinates();
 
     return public_key;
@@ -24,8 +24,11 @@
 
 #pragma once
 
+#include <utility>
 #include <vector>
 
+#include <dkg/VerificationVector.h>
+
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
 #include <libff/algebra/fields/fp.hpp>
 
@@ -52,6 +55,23 @@ public:
     bool Verification( size_t idx, libff::alt_bn128_Fr share,
         const std::vector< libff::alt_bn128_G2 >& verification_vector );
 
+    bool Verification( size_t idx, const libff::alt_bn128_Fr& share,
+        const libBLS::VerificationVector& commitments );
+
+    // idx-th node verifies the shares of all dealers at once, returns dealers whose share
+    // does not correspond to their verification vector
+    std::vector< size_t > VerifyAll( size_t idx, const std::vector< libff::alt_bn128_Fr >& shares,
+        const std::vector< std::vector< libff::alt_bn128_G2 > >& verification_vectors );
+
+    // coefficient-wise sum of the verification vectors of all dealers, it commits to the
+    // polynomial whose value at idx + 1 is the secret key share of the idx-th node
+    std::vector< libff::alt_bn128_G2 > AggregateVerificationVectors(
+        const std::vector< std::vector< libff::alt_bn128_G2 > >& verification_vectors );
+
+    // common public key and public key shares of all n nodes without their secret key shares
+    std::pair< libff::alt_bn128_G2, std::vector< libff::alt_bn128_G2 > > PublicKeyShares(
+        const std::vector< std::vector< libff::alt_bn128_G2 > >& verification_vectors );
+
     libff::alt_bn128_G2 GetPublicKeyFromSecretKey( const libff::alt_bn128_Fr& secret_key );
 
     size_t GetT() const;
@@ -24,8 +24,11 @@
 #ifndef LIBBLS_LIBBLS_H
 #define LIBBLS_LIBBLS_H
 
+#include <bls/BLSPartialSignature.h>
 #include <bls/BLSPrivateKey.h>
 #include <bls/BLSPublicKeyShare.h>
+#include <bls/BLSConcurrentSigShareSet.h>
+#include <bls/BLSSigShareCombiner.h>
 #include <bls/BLSSigShareSet.h>
 
 #include <dkg/DKGBLSWrapper.h>
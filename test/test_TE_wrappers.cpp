@@ -38,6 +38,7 @@ along with libBLS. If not, see <https://www.gnu.org/licenses/>.
 #include <boost/test/included/unit_test.hpp>
 
 #include <dkg/DKGTEWrapper.h>
+#include <dkg/DkgAccumulator.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <random>
@@ -238,6 +239,49 @@ BOOST_AUTO_TEST_CASE( WrappersFromString ) {
     std::cerr << "TE wrappers tests finished" << std::endl;
 }
 
+BOOST_AUTO_TEST_CASE( WrappersFromBytes ) {
+    for ( size_t i = 0; i < 10; i++ ) {
+        size_t num_all = rand_gen() % 16 + 1;
+        size_t num_signed = rand_gen() % num_all + 1;
+
+        auto keys = TEPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+
+        auto common_pkey = keys.second;
+        auto common_pkey_bytes = common_pkey->toBytes();
+        BOOST_REQUIRE( common_pkey_bytes->size() == 1 + BLS_G2_BYTES );
+        auto common_pkey_copy = TEPublicKey::fromBytes( *common_pkey_bytes, num_signed, num_all );
+        BOOST_REQUIRE( common_pkey_copy->getPublicKey() == common_pkey->getPublicKey() );
+
+        TEPrivateKey private_key( libff::alt_bn128_Fr::random_element(), num_signed, num_all );
+        auto private_key_copy =
+            TEPrivateKey::fromBytes( *private_key.toBytes(), num_signed, num_all );
+        BOOST_REQUIRE( private_key_copy->getPrivateKey() == private_key.getPrivateKey() );
+
+        size_t signer = rand_gen() % num_all + 1;
+        auto skey = keys.first->at( signer - 1 );
+        auto skey_copy =
+            TEPrivateKeyShare::fromBytes( *skey->toBytes(), signer, num_signed, num_all );
+        BOOST_REQUIRE( skey_copy->getPrivateKey() == skey->getPrivateKey() );
+        BOOST_REQUIRE( skey_copy->getSignerIndex() == signer );
+
+        TEPublicKeyShare pkey( *skey, num_signed, num_all );
+        auto pkey_copy =
+            TEPublicKeyShare::fromBytes( *pkey.toBytes(), signer, num_signed, num_all );
+        BOOST_REQUIRE( pkey_copy->getPublicKey() == pkey.getPublicKey() );
+
+        libBLS::Ciphertext cypher = common_pkey_copy->encrypt(
+            std::make_shared< std::string >( std::string( 64, 'a' ) ) );
+        BOOST_REQUIRE( pkey_copy->Verify( cypher, skey_copy->getDecryptionShare( cypher ) ) );
+
+        ( *common_pkey_bytes )[0] = BLS_BINARY_FORMAT_VERSION + 1;
+        BOOST_REQUIRE_THROW( TEPublicKey::fromBytes( *common_pkey_bytes, num_signed, num_all ),
+            libBLS::ThresholdUtils::IncorrectInput );
+        common_pkey_bytes->pop_back();
+        BOOST_REQUIRE_THROW( TEPublicKey::fromBytes( *common_pkey_bytes, num_signed, num_all ),
+            libBLS::ThresholdUtils::IncorrectInput );
+    }
+}
+
 BOOST_AUTO_TEST_CASE( ThresholdEncryptionWithDKG ) {
     for ( size_t i = 0; i < 10; i++ ) {
         size_t num_all = rand_gen() % 15 + 2;
@@ -327,6 +371,50 @@ BOOST_AUTO_TEST_CASE( ThresholdEncryptionWithDKG ) {
     }
 }
 
+BOOST_AUTO_TEST_CASE( ThresholdEncryptionWithDkgAccumulator ) {
+    size_t num_all = rand_gen() % 15 + 2;
+    size_t num_signed = rand_gen() % num_all + 1;
+
+    std::vector< DKGTEWrapper > dkgs;
+    std::vector< std::shared_ptr< libBLS::DkgAccumulator > > accumulators;
+    for ( size_t i = 0; i < num_all; i++ ) {
+        dkgs.emplace_back( num_signed, num_all );
+        accumulators.push_back(
+            std::make_shared< libBLS::DkgAccumulator >( i, num_signed, num_all ) );
+    }
+
+    for ( size_t j = 0; j < num_all; j++ ) {
+        auto secret_shares = dkgs.at( j ).createDKGSecretShares();
+        auto public_shares = dkgs.at( j ).createDKGPublicShares();
+        for ( size_t i = 0; i < num_all; i++ ) {
+            BOOST_REQUIRE(
+                accumulators.at( i )->addDealer( j, secret_shares->at( i ), *public_shares ) );
+        }
+    }
+
+    TEPublicKey common_public =
+        DKGTEWrapper::CreateTEPublicKey( *accumulators.at( 0 ), num_signed, num_all );
+
+    std::string message;
+    for ( size_t length = 0; length < 64; ++length ) {
+        message += char( rand_gen() % 128 );
+    }
+    libBLS::Ciphertext cypher =
+        common_public.encrypt( std::make_shared< std::string >( message ) );
+
+    TEDecryptSet decr_set( num_signed, num_all );
+    for ( size_t i = 0; i < num_signed; i++ ) {
+        TEPrivateKeyShare skey = dkgs.at( i ).CreateTEPrivateKeyShare( *accumulators.at( i ) );
+        TEPublicKeyShare pkey( skey, num_signed, num_all );
+        libff::alt_bn128_G2 decrypt = skey.getDecryptionShare( cypher );
+        BOOST_REQUIRE( pkey.Verify( cypher, decrypt ) );
+        decr_set.addDecrypt(
+            skey.getSignerIndex(), std::make_shared< libff::alt_bn128_G2 >( decrypt ) );
+    }
+
+    BOOST_REQUIRE( decr_set.merge( cypher ) == message );
+}
+
 BOOST_AUTO_TEST_CASE( ExceptionsTest ) {
     size_t num_all = rand_gen() % 15 + 2;
     size_t num_signed = rand_gen() % num_all + 1;
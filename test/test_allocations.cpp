@@ -0,0 +1,153 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+  @file test_allocations.cpp
+  @author SKALE Labs
+  @date 2026
+*/
+
+#include <bls/BLSPrivateKeyShare.h>
+#include <bls/BLSPublicKey.h>
+#include <bls/BLSPublicKeyShare.h>
+#include <bls/BLSSigShareSet.h>
+#include <tools/utils.h>
+
+#include <atomic>
+#include <cstdlib>
+#include <ctime>
+#include <new>
+#include <random>
+
+#define BOOST_TEST_MODULE
+#ifdef EMSCRIPTEN
+#define BOOST_TEST_DISABLE_ALT_STACK
+#endif  // EMSCRIPTEN
+
+#include <boost/test/included/unit_test.hpp>
+#include <libff/algebra/curves/alt_bn128/alt_bn128_pairing.hpp>
+
+// counts every heap allocation of the test binary, it replaces the global operator new so
+// it lives in its own executable
+static std::atomic< size_t > allocations_count( 0 );
+
+void* operator new( size_t size ) {
+    ++allocations_count;
+    if ( void* ptr = std::malloc( size ) ) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete( void* ptr ) noexcept {
+    std::free( ptr );
+}
+
+void operator delete( void* ptr, size_t ) noexcept {
+    std::free( ptr );
+}
+
+BOOST_AUTO_TEST_SUITE( Allocations )
+
+std::default_random_engine rand_gen( ( unsigned int ) time( 0 ) );
+
+std::array< uint8_t, 32 > GenerateRandHash() {
+    std::array< uint8_t, 32 > hash_byte_arr;
+    for ( size_t i = 0; i < 32; i++ ) {
+        hash_byte_arr.at( i ) = rand_gen() % 256;
+    }
+
+    return hash_byte_arr;
+}
+
+// allocations of the pairing check done by a verification, libff may allocate inside the
+// Miller loop and the final exponentiation depending on its build
+size_t PairingAllocations( const std::array< uint8_t, 32 >& hash_byte_arr,
+    const libff::alt_bn128_G1& sign, const libff::alt_bn128_ate_G2_precomp& public_key_precomp ) {
+    libff::alt_bn128_G1 hash = libBLS::ThresholdUtils::HashtoG1WithCounter( hash_byte_arr ).first;
+
+    size_t before = allocations_count;
+    libff::alt_bn128_Fq12 miller_loop =
+        libff::alt_bn128_ate_double_miller_loop( libff::alt_bn128_ate_precompute_G1( -sign ),
+            libBLS::ThresholdUtils::G2GeneratorPrecomp(),
+            libff::alt_bn128_ate_precompute_G1( hash ), public_key_precomp );
+    libff::alt_bn128_final_exponentiation( miller_loop );
+
+    return allocations_count - before;
+}
+
+BOOST_AUTO_TEST_CASE( valueSignAndVerify ) {
+    size_t num_all = rand_gen() % 16 + 2;
+    size_t num_signed = rand_gen() % num_all + 1;
+
+    auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+    BLSPublicKey common_pkey( *keys->second );
+
+    std::vector< std::shared_ptr< BLSPublicKeyShare > > pkeys;
+    std::vector< std::array< uint8_t, 32 > > hashes;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        pkeys.push_back( std::make_shared< BLSPublicKeyShare >(
+            *keys->first->at( i )->getPrivateKey(), num_signed, num_all ) );
+        hashes.push_back( GenerateRandHash() );
+    }
+    std::vector< libBLS::SigWithHint > sig_shares( num_signed );
+
+    // the key precomputations are built on the first verification
+    auto warm_up = keys->first->at( 0 )->sign( hashes[0] );
+    BOOST_REQUIRE( pkeys[0]->VerifySig( hashes[0], warm_up.sig ) );
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        pkeys[i]->getPublicKeyPrecomp();
+    }
+    common_pkey.getPublicKeyPrecomp();
+
+    size_t before = allocations_count;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        sig_shares[i] = keys->first->at( i )->sign( hashes[i] );
+    }
+    BOOST_REQUIRE_EQUAL( allocations_count - before, 0 );
+
+    // a verification allocates exactly what its pairing allocates
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        size_t pairing_allocations =
+            PairingAllocations( hashes[i], sig_shares[i].sig, *pkeys[i]->getPublicKeyPrecomp() );
+        before = allocations_count;
+        BOOST_REQUIRE( pkeys[i]->VerifySig( hashes[i], sig_shares[i].sig ) );
+        BOOST_REQUIRE_EQUAL( allocations_count - before, pairing_allocations );
+
+        const auto& other_hash = hashes[( i + 1 ) % num_signed];
+        pairing_allocations =
+            PairingAllocations( other_hash, sig_shares[i].sig, *pkeys[i]->getPublicKeyPrecomp() );
+        before = allocations_count;
+        BOOST_REQUIRE( !pkeys[i]->VerifySig( other_hash, sig_shares[i].sig ) || num_signed == 1 );
+        BOOST_REQUIRE_EQUAL( allocations_count - before, pairing_allocations );
+    }
+
+    auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( hashes[0] );
+    BLSSigShareSet sig_set( num_signed, num_all );
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        sig_set.addSigShare( keys->first->at( i )->sign( hash_ptr, i + 1 ) );
+    }
+    libff::alt_bn128_G1 common_sig = *sig_set.merge()->getSig();
+
+    size_t pairing_allocations =
+        PairingAllocations( hashes[0], common_sig, *common_pkey.getPublicKeyPrecomp() );
+    before = allocations_count;
+    BOOST_REQUIRE( common_pkey.VerifySig( hashes[0], common_sig ) );
+    BOOST_REQUIRE_EQUAL( allocations_count - before, pairing_allocations );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -25,16 +25,23 @@
 #include <dkg/dkg.h>
 #include <ctime>
 
+#include <bls/BLSConcurrentSigShareSet.h>
+#include <bls/BLSPartialSignature.h>
 #include <bls/BLSPrivateKey.h>
 #include <bls/BLSPrivateKeyShare.h>
 #include <bls/BLSPublicKey.h>
 #include <bls/BLSPublicKeyShare.h>
 #include <bls/BLSSigShare.h>
+#include <bls/BLSSigShareCombiner.h>
 #include <bls/BLSSigShareSet.h>
 #include <bls/BLSSignature.h>
 #include <tools/utils.h>
 
+#include <algorithm>
+#include <atomic>
 #include <map>
+#include <set>
+#include <thread>
 
 #include <dkg/DKGBLSWrapper.h>
 
@@ -845,6 +852,572 @@ BOOST_AUTO_TEST_CASE( BLSAGGREGATEDPOPPROVEVERIFY ) {
     std::cout << "BLS AGGREGATED POP PROVE VERIFY TEST PASSED\n";
 }
 
+BOOST_AUTO_TEST_CASE( aggregatedVerificationOffsettingErrors ) {
+    std::cout << "Testing aggregatedVerificationOffsettingErrors\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    auto key_pair = libBLS::Bls::KeyGeneration();
+
+    size_t num_hashes = rand_gen() % 10 + 2;
+    std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > hashes( num_hashes );
+    std::vector< libff::alt_bn128_G1 > signatures( num_hashes );
+    for ( size_t i = 0; i < num_hashes; ++i ) {
+        hashes[i] = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+        signatures[i] = key_pair.first * libBLS::ThresholdUtils::HashtoG1( hashes[i] );
+    }
+
+    BOOST_REQUIRE( libBLS::Bls::AggregatedVerification( hashes, signatures, key_pair.second ) );
+
+    // errors cancel out in the plain sum of signatures
+    libff::alt_bn128_G1 delta = libff::alt_bn128_G1::random_element();
+    auto malicious_signatures = signatures;
+    malicious_signatures[0] = malicious_signatures[0] + delta;
+    malicious_signatures[1] = malicious_signatures[1] - delta;
+
+    BOOST_REQUIRE( !libBLS::Bls::AggregatedVerification(
+        hashes, malicious_signatures, key_pair.second ) );
+
+    hashes.pop_back();
+    BOOST_REQUIRE_THROW(
+        libBLS::Bls::AggregatedVerification( hashes, signatures, key_pair.second ),
+        libBLS::ThresholdUtils::IncorrectInput );
+
+    BOOST_REQUIRE( libBLS::Bls::AggregatedVerification( {}, {}, key_pair.second ) );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( batchVerifyManyKeys ) {
+    std::cout << "Testing batchVerifyManyKeys\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        size_t num_keys = rand_gen() % 3 + 1;
+        std::vector< std::pair< libff::alt_bn128_Fr, libff::alt_bn128_G2 > > key_pairs;
+        for ( size_t k = 0; k < num_keys; ++k ) {
+            key_pairs.push_back( libBLS::Bls::KeyGeneration() );
+        }
+
+        size_t num_entries = rand_gen() % 12 + 1;
+        std::set< size_t > bad_entries;
+        std::vector< std::tuple< std::shared_ptr< std::array< uint8_t, 32 > >,
+            libff::alt_bn128_G1, libff::alt_bn128_G2 > >
+            entries;
+
+        for ( size_t j = 0; j < num_entries; ++j ) {
+            auto& key_pair = key_pairs[rand_gen() % num_keys];
+            auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+            libff::alt_bn128_G1 sign =
+                key_pair.first * libBLS::ThresholdUtils::HashtoG1( hash_ptr );
+
+            if ( rand_gen() % 3 == 0 ) {
+                sign = sign + libff::alt_bn128_G1::random_element();
+                bad_entries.insert( j );
+            }
+
+            // the same key in another projective representation
+            libff::alt_bn128_G2 public_key = key_pair.second;
+            if ( rand_gen() % 2 == 0 ) {
+                public_key = public_key.dbl() - public_key;
+            }
+
+            entries.emplace_back( hash_ptr, sign, public_key );
+        }
+
+        std::vector< size_t > failed = libBLS::Bls::BatchVerify( entries );
+        BOOST_REQUIRE( std::set< size_t >( failed.begin(), failed.end() ) == bad_entries );
+        BOOST_REQUIRE( failed.size() == bad_entries.size() );
+
+        for ( size_t j = 0; j < num_entries; ++j ) {
+            BOOST_REQUIRE( libBLS::Bls::Verification( std::get< 0 >( entries[j] ),
+                               std::get< 1 >( entries[j] ), std::get< 2 >( entries[j] ) ) ==
+                           !bad_entries.count( j ) );
+        }
+    }
+
+    BOOST_REQUIRE( libBLS::Bls::BatchVerify( {} ).empty() );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( publicKeyPrecompReuse ) {
+    std::cout << "Testing publicKeyPrecompReuse\n";
+
+    size_t num_all = 4;
+    size_t num_signed = 3;
+
+    auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+    std::shared_ptr< BLSPrivateKeyShare > skey_share = keys->first->at( 0 );
+    BLSPublicKeyShare pkey_share( *skey_share->getPrivateKey(), num_signed, num_all );
+    BLSPublicKey common_pkey( *keys->second );
+
+    BOOST_REQUIRE( pkey_share.getPublicKeyPrecomp() == pkey_share.getPublicKeyPrecomp() );
+    BOOST_REQUIRE( common_pkey.getPublicKeyPrecomp() == common_pkey.getPublicKeyPrecomp() );
+
+    BLSPublicKeyShare pkey_share_copy( pkey_share );
+    BOOST_REQUIRE( pkey_share_copy.getPublicKeyPrecomp() == pkey_share.getPublicKeyPrecomp() );
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+        std::shared_ptr< BLSSigShare > sig_share = skey_share->sign( hash_ptr, 1 );
+        BOOST_REQUIRE( pkey_share.VerifySig( hash_ptr, sig_share, num_signed, num_all ) );
+        BOOST_REQUIRE( pkey_share.VerifySigWithHelper( hash_ptr, sig_share, num_signed, num_all ) );
+        BOOST_REQUIRE( pkey_share_copy.VerifySig( hash_ptr, sig_share, num_signed, num_all ) );
+
+        auto other_hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+        BOOST_REQUIRE( !pkey_share.VerifySig( other_hash_ptr, sig_share, num_signed, num_all ) );
+        BOOST_REQUIRE(
+            !pkey_share.VerifySigWithHelper( other_hash_ptr, sig_share, num_signed, num_all ) );
+
+        BLSSigShareSet sig_set( num_signed, num_all );
+        for ( size_t j = 0; j < num_signed; ++j ) {
+            sig_set.addSigShare( keys->first->at( j )->sign( hash_ptr, j + 1 ) );
+        }
+        std::shared_ptr< BLSSignature > common_sig = sig_set.merge();
+        BOOST_REQUIRE( common_pkey.VerifySig( hash_ptr, common_sig ) );
+        BOOST_REQUIRE( common_pkey.VerifySigWithHelper( hash_ptr, common_sig ) );
+        BOOST_REQUIRE( !common_pkey.VerifySig( other_hash_ptr, common_sig ) );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( sigShareSetVerifyAll ) {
+    std::cout << "Testing sigShareSetVerifyAll\n";
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        size_t num_all = rand_gen() % 16 + 2;
+        size_t num_signed = rand_gen() % num_all + 1;
+
+        auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+
+        auto pkeys_map =
+            std::make_shared< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >();
+        for ( size_t j = 0; j < num_all; ++j ) {
+            ( *pkeys_map )[j + 1] = std::make_shared< BLSPublicKeyShare >(
+                *keys->first->at( j )->getPrivateKey(), num_signed, num_all );
+        }
+
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+        auto other_hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+
+        std::set< size_t > bad_signers;
+        size_t num_bad = rand_gen() % ( num_all + 1 );
+        while ( bad_signers.size() < num_bad ) {
+            bad_signers.insert( rand_gen() % num_all + 1 );
+        }
+
+        BLSSigShareSet sig_set( num_signed, num_all );
+        for ( size_t j = 1; j <= num_all; ++j ) {
+            auto signed_hash = bad_signers.count( j ) ? other_hash_ptr : hash_ptr;
+            sig_set.addSigShare( keys->first->at( j - 1 )->sign( signed_hash, j ) );
+        }
+
+        std::vector< size_t > failed = sig_set.verifyAll( hash_ptr, pkeys_map );
+        BOOST_REQUIRE( std::set< size_t >( failed.begin(), failed.end() ) == bad_signers );
+        BOOST_REQUIRE( failed.size() == bad_signers.size() );
+
+        pkeys_map->erase( 1 );
+        BOOST_REQUIRE_THROW(
+            sig_set.verifyAll( hash_ptr, pkeys_map ), libBLS::ThresholdUtils::IncorrectInput );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( sigShareSetMergeVerified ) {
+    std::cout << "Testing sigShareSetMergeVerified\n";
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        size_t num_all = rand_gen() % 16 + 2;
+        size_t num_signed = rand_gen() % num_all + 1;
+
+        auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+        auto common_pkey = std::make_shared< BLSPublicKey >( *keys->second );
+
+        auto pkeys_map =
+            std::make_shared< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >();
+        for ( size_t j = 0; j < num_all; ++j ) {
+            ( *pkeys_map )[j + 1] = std::make_shared< BLSPublicKeyShare >(
+                *keys->first->at( j )->getPrivateKey(), num_signed, num_all );
+        }
+
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+        auto other_hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+
+        // as many bad signers as can be tolerated, then one more
+        for ( size_t num_bad : { size_t( 0 ), num_all - num_signed, num_all - num_signed + 1 } ) {
+            std::set< size_t > bad_signers;
+            while ( bad_signers.size() < num_bad ) {
+                bad_signers.insert( rand_gen() % num_all + 1 );
+            }
+
+            BLSSigShareSet sig_set( num_signed, num_all );
+            for ( size_t j = 1; j <= num_all; ++j ) {
+                auto signed_hash = bad_signers.count( j ) ? other_hash_ptr : hash_ptr;
+                sig_set.addSigShare( keys->first->at( j - 1 )->sign( signed_hash, j ) );
+            }
+
+            if ( num_bad > num_all - num_signed ) {
+                BOOST_REQUIRE_THROW( sig_set.mergeVerified( hash_ptr, common_pkey, pkeys_map ),
+                    libBLS::ThresholdUtils::IncorrectInput );
+                continue;
+            }
+
+            std::shared_ptr< BLSSignature > common_sig =
+                sig_set.mergeVerified( hash_ptr, common_pkey, pkeys_map );
+            BOOST_REQUIRE( common_pkey->VerifySig( hash_ptr, common_sig ) );
+
+            // bad shares are only looked for if they got into the optimistic merge
+            if ( sig_set.getTotalSigSharesCount() != num_all ) {
+                BOOST_REQUIRE( sig_set.getTotalSigSharesCount() == num_all - num_bad );
+                for ( size_t bad_signer : bad_signers ) {
+                    BOOST_REQUIRE( sig_set.getSigShareByIndex( bad_signer ) == nullptr );
+                }
+            }
+        }
+
+        // a failed merge leaves the set open for more shares
+        size_t num_required = rand_gen() % ( num_all - 1 ) + 1;
+        auto required_keys = BLSPrivateKeyShare::generateSampleKeys( num_required, num_all );
+        auto required_pkey = std::make_shared< BLSPublicKey >( *required_keys->second );
+        auto required_pkeys_map =
+            std::make_shared< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >();
+        for ( size_t j = 0; j < num_all; ++j ) {
+            ( *required_pkeys_map )[j + 1] = std::make_shared< BLSPublicKeyShare >(
+                *required_keys->first->at( j )->getPrivateKey(), num_required, num_all );
+        }
+
+        BLSSigShareSet sig_set( num_required, num_all );
+        sig_set.addSigShare( required_keys->first->at( 0 )->sign( other_hash_ptr, 1 ) );
+        for ( size_t j = 2; j <= num_required; ++j ) {
+            sig_set.addSigShare( required_keys->first->at( j - 1 )->sign( hash_ptr, j ) );
+        }
+
+        auto incomplete_pkeys_map =
+            std::make_shared< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >(
+                *required_pkeys_map );
+        incomplete_pkeys_map->erase( 1 );
+        BOOST_REQUIRE_THROW( sig_set.mergeVerified( hash_ptr, required_pkey, incomplete_pkeys_map ),
+            libBLS::ThresholdUtils::IncorrectInput );
+
+        BOOST_REQUIRE_THROW( sig_set.mergeVerified( hash_ptr, required_pkey, required_pkeys_map ),
+            libBLS::ThresholdUtils::IncorrectInput );
+        BOOST_REQUIRE( sig_set.getTotalSigSharesCount() == num_required - 1 );
+
+        sig_set.addSigShare( required_keys->first->at( num_required )->sign(
+            hash_ptr, num_required + 1 ) );
+        std::shared_ptr< BLSSignature > common_sig =
+            sig_set.mergeVerified( hash_ptr, required_pkey, required_pkeys_map );
+        BOOST_REQUIRE( required_pkey->VerifySig( hash_ptr, common_sig ) );
+
+        // valid shares under a common key they do not belong to
+        auto other_keys = BLSPrivateKeyShare::generateSampleKeys( num_required, num_all );
+        auto other_pkey = std::make_shared< BLSPublicKey >( *other_keys->second );
+
+        BLSSigShareSet mismatched_set( num_required, num_all );
+        for ( size_t j = 1; j <= num_required; ++j ) {
+            mismatched_set.addSigShare( required_keys->first->at( j - 1 )->sign( hash_ptr, j ) );
+        }
+        BOOST_REQUIRE_THROW(
+            mismatched_set.mergeVerified( hash_ptr, other_pkey, required_pkeys_map ),
+            libBLS::ThresholdUtils::IncorrectInput );
+        BOOST_REQUIRE( mismatched_set.getTotalSigSharesCount() == num_required );
+        BOOST_REQUIRE( required_pkey->VerifySig( hash_ptr, mismatched_set.merge() ) );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( sigShareCombiner ) {
+    std::cout << "Testing sigShareCombiner\n";
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        size_t num_all = rand_gen() % 16 + 2;
+        size_t num_signed = rand_gen() % num_all + 1;
+
+        auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+        BLSPublicKey common_pkey( *keys->second );
+
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+
+        std::vector< size_t > signers( num_all );
+        for ( size_t j = 0; j < num_all; ++j ) {
+            signers[j] = j + 1;
+        }
+        std::shuffle( signers.begin(), signers.end(), rand_gen );
+
+        BLSSigShareCombiner combiner( num_signed, num_all );
+        BLSSigShareSet sig_set( num_signed, num_all );
+        for ( size_t j = 0; j < num_all; ++j ) {
+            auto sig_share = keys->first->at( signers[j] - 1 )->sign( hash_ptr, signers[j] );
+            BOOST_REQUIRE( combiner.addSigShare( sig_share ) == ( j < num_signed ) );
+            sig_set.addSigShare( sig_share );
+
+            if ( j == 0 && num_signed > 1 ) {
+                BOOST_REQUIRE_THROW(
+                    combiner.addSigShare( sig_share ), libBLS::ThresholdUtils::IncorrectInput );
+                BOOST_REQUIRE_THROW( combiner.merge(), libBLS::ThresholdUtils::IncorrectInput );
+            }
+        }
+
+        std::shared_ptr< BLSSignature > common_sig = combiner.merge();
+        BOOST_REQUIRE( common_pkey.VerifySig( hash_ptr, common_sig ) );
+        BOOST_REQUIRE( *common_sig->getSig() == *sig_set.merge()->getSig() );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( partialSignatures ) {
+    std::cout << "Testing partialSignatures\n";
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        size_t num_all = rand_gen() % 16 + 2;
+        size_t num_signed = rand_gen() % num_all + 1;
+
+        auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+        BLSPublicKey common_pkey( *keys->second );
+
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+
+        std::vector< size_t > signers( num_all );
+        for ( size_t j = 0; j < num_all; ++j ) {
+            signers[j] = j + 1;
+        }
+        std::shuffle( signers.begin(), signers.end(), rand_gen );
+        std::vector< size_t > final_signers( signers.begin(), signers.begin() + num_signed );
+
+        // every relay gets up to three shares and a share of a signer outside the final set
+        std::vector< std::shared_ptr< BLSPartialSignature > > partials;
+        for ( size_t j = 0; j < num_signed; j += 3 ) {
+            BLSSigShareSet relay_set( num_signed, num_all );
+            for ( size_t k = j; k < std::min( j + 3, num_signed ); ++k ) {
+                relay_set.addSigShare(
+                    keys->first->at( final_signers[k] - 1 )->sign( hash_ptr, final_signers[k] ) );
+            }
+            if ( num_signed < num_all ) {
+                relay_set.addSigShare(
+                    keys->first->at( signers.back() - 1 )->sign( hash_ptr, signers.back() ) );
+            }
+            // relays forward their partials in the binary format
+            auto partial = relay_set.mergePartial( final_signers );
+            auto partial_copy = BLSPartialSignature::fromBytes( *partial->toBytes() );
+            BOOST_REQUIRE( *partial_copy->getSig() == *partial->getSig() );
+            BOOST_REQUIRE( partial_copy->getHint() == partial->getHint() );
+            BOOST_REQUIRE( partial_copy->getSignerSet() == partial->getSignerSet() );
+            BOOST_REQUIRE( partial_copy->getSigners() == partial->getSigners() );
+            BOOST_REQUIRE( partial_copy->getRequiredSigners() == num_signed );
+            BOOST_REQUIRE( partial_copy->getTotalSigners() == num_all );
+            partials.push_back( partial_copy );
+        }
+
+        auto bytes = partials.front()->toBytes();
+        bytes->pop_back();
+        BOOST_REQUIRE_THROW(
+            BLSPartialSignature::fromBytes( *bytes ), libBLS::ThresholdUtils::IncorrectInput );
+        bytes = partials.front()->toBytes();
+        ( *bytes )[0] = BLS_BINARY_FORMAT_VERSION + 1;
+        BOOST_REQUIRE_THROW(
+            BLSPartialSignature::fromBytes( *bytes ), libBLS::ThresholdUtils::IncorrectInput );
+
+        // partials are merged from the end, so that merging is not in the order of relays
+        std::shared_ptr< BLSPartialSignature > merged = partials.back();
+        for ( size_t j = partials.size() - 1; j-- > 0; ) {
+            BOOST_REQUIRE( !merged->isComplete() );
+            BOOST_REQUIRE_THROW( merged->toSignature(), libBLS::ThresholdUtils::IncorrectInput );
+            BOOST_REQUIRE_THROW(
+                merged->merge( *partials.back() ), libBLS::ThresholdUtils::IncorrectInput );
+            merged = partials[j]->merge( *merged );
+        }
+
+        BOOST_REQUIRE( merged->isComplete() );
+        std::shared_ptr< BLSSignature > common_sig = merged->toSignature();
+        BOOST_REQUIRE( common_pkey.VerifySig( hash_ptr, common_sig ) );
+
+        BLSSigShareSet sig_set( num_signed, num_all );
+        for ( size_t index : final_signers ) {
+            sig_set.addSigShare( keys->first->at( index - 1 )->sign( hash_ptr, index ) );
+        }
+        BOOST_REQUIRE( *common_sig->getSig() == *sig_set.merge()->getSig() );
+
+        std::vector< size_t > short_set( final_signers.begin(), final_signers.end() - 1 );
+        BOOST_REQUIRE_THROW(
+            sig_set.mergePartial( short_set ), libBLS::ThresholdUtils::IncorrectInput );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( concurrentSigShareSet ) {
+    std::cout << "Testing concurrentSigShareSet\n";
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        size_t num_all = rand_gen() % 16 + 2;
+        size_t num_signed = rand_gen() % num_all + 1;
+
+        auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+        BLSPublicKey common_pkey( *keys->second );
+
+        auto pkeys_map =
+            std::make_shared< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >();
+        for ( size_t j = 0; j < num_all; ++j ) {
+            ( *pkeys_map )[j + 1] = std::make_shared< BLSPublicKeyShare >(
+                *keys->first->at( j )->getPrivateKey(), num_signed, num_all );
+        }
+
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+        auto other_hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+
+        std::atomic< size_t > num_merges( 0 );
+        BLSConcurrentSigShareSet sig_set( num_signed, num_all, hash_ptr, pkeys_map,
+            [&num_merges]( std::shared_ptr< BLSSignature > ) { ++num_merges; } );
+
+        // the first signer sends a share of another message, which is not counted
+        BOOST_REQUIRE(
+            !sig_set.addSigShare( keys->first->at( 0 )->sign( other_hash_ptr, 1 ) ) );
+        BOOST_REQUIRE( sig_set.getSigShareByIndex( 1 ) == nullptr );
+
+        std::vector< std::thread > threads;
+        for ( size_t t = 0; t < 4; ++t ) {
+            threads.emplace_back( [&, t]() {
+                for ( size_t j = t + 1; j <= num_all; j += 4 ) {
+                    sig_set.addSigShare( keys->first->at( j - 1 )->sign( hash_ptr, j ) );
+                }
+            } );
+        }
+        for ( auto& thread : threads ) {
+            thread.join();
+        }
+
+        BOOST_REQUIRE( num_merges == 1 );
+        BOOST_REQUIRE( sig_set.isEnough() );
+        BOOST_REQUIRE( sig_set.getTotalSigSharesCount() == num_all );
+
+        std::shared_ptr< BLSSignature > common_sig = sig_set.getSignature().get();
+        BOOST_REQUIRE( common_pkey.VerifySig( hash_ptr, common_sig ) );
+
+        BOOST_REQUIRE_THROW(
+            sig_set.addSigShare( keys->first->at( 0 )->sign( hash_ptr, 1 ) ),
+            libBLS::ThresholdUtils::IncorrectInput );
+        BOOST_REQUIRE_THROW( sig_set.getSigShareByIndex( num_all + 1 ),
+            libBLS::ThresholdUtils::IncorrectInput );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( binaryFormat ) {
+    std::cout << "Testing binaryFormat\n";
+
+    for ( size_t i = 0; i < 3; ++i ) {
+        size_t num_all = rand_gen() % 16 + 2;
+        size_t num_signed = rand_gen() % num_all + 1;
+
+        auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+
+        BLSSigShareSet sig_set( num_signed, num_all );
+        for ( size_t j = 0; j < num_signed; ++j ) {
+            auto skey = keys->first->at( j );
+            auto skey_copy =
+                BLSPrivateKeyShare::fromBytes( *skey->toBytes(), num_signed, num_all );
+            BOOST_REQUIRE( *skey_copy->getPrivateKey() == *skey->getPrivateKey() );
+
+            BLSPublicKeyShare pkey( *skey->getPrivateKey(), num_signed, num_all );
+            auto pkey_copy = BLSPublicKeyShare::fromBytes( *pkey.toBytes(), num_signed, num_all );
+            BOOST_REQUIRE( *pkey_copy->getPublicKey() == *pkey.getPublicKey() );
+
+            auto sig_share = skey->sign( hash_ptr, j + 1 );
+            auto sig_share_copy =
+                BLSSigShare::fromBytes( *sig_share->toBytes(), j + 1, num_signed, num_all );
+            BOOST_REQUIRE( *sig_share_copy->getSigShare() == *sig_share->getSigShare() );
+            BOOST_REQUIRE( sig_share_copy->getHint() == sig_share->getHint() );
+            BOOST_REQUIRE( pkey_copy->VerifySigWithHelper(
+                hash_ptr, sig_share_copy, num_signed, num_all ) );
+
+            sig_set.addSigShare( sig_share_copy );
+        }
+
+        BLSPublicKey common_pkey( *keys->second );
+        auto common_pkey_copy = BLSPublicKey::fromBytes( *common_pkey.toBytes() );
+        BOOST_REQUIRE( *common_pkey_copy->getPublicKey() == *common_pkey.getPublicKey() );
+
+        auto common_sig = sig_set.merge();
+        auto bytes = common_sig->toBytes();
+        BOOST_REQUIRE( bytes->size() == 1 + BLS_G1_BYTES + BLS_HINT_BYTES );
+        BOOST_REQUIRE( bytes->size() * 3 < common_sig->toString()->size() );
+
+        auto common_sig_copy = BLSSignature::fromBytes( *bytes, num_signed, num_all );
+        BOOST_REQUIRE( common_pkey_copy->VerifySig( hash_ptr, common_sig_copy ) );
+
+        BLSPrivateKey skey( *keys->first->at( 0 )->getPrivateKey(), num_signed, num_all );
+        auto skey_copy = BLSPrivateKey::fromBytes( *skey.toBytes(), num_signed, num_all );
+        BOOST_REQUIRE( *skey_copy->getPrivateKey() == *skey.getPrivateKey() );
+
+        ( *bytes )[0] = BLS_BINARY_FORMAT_VERSION + 1;
+        BOOST_REQUIRE_THROW( BLSSignature::fromBytes( *bytes, num_signed, num_all ),
+            libBLS::ThresholdUtils::IncorrectInput );
+        bytes->pop_back();
+        BOOST_REQUIRE_THROW( BLSSignature::fromBytes( *bytes, num_signed, num_all ),
+            libBLS::ThresholdUtils::IncorrectInput );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( valueSignAndVerify ) {
+    std::cout << "Testing valueSignAndVerify\n";
+
+    size_t num_all = rand_gen() % 16 + 2;
+    size_t num_signed = rand_gen() % num_all + 1;
+
+    auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+    BLSPublicKey common_pkey( *keys->second );
+
+    std::vector< std::shared_ptr< BLSPublicKeyShare > > pkeys;
+    std::vector< std::array< uint8_t, 32 > > hashes;
+    std::vector< libBLS::SigWithHint > sig_shares;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        pkeys.push_back( std::make_shared< BLSPublicKeyShare >(
+            *keys->first->at( i )->getPrivateKey(), num_signed, num_all ) );
+        hashes.push_back( GenerateRandHash() );
+        sig_shares.push_back( keys->first->at( i )->sign( hashes[i] ) );
+    }
+
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        BOOST_REQUIRE( pkeys[i]->VerifySig( hashes[i], sig_shares[i].sig ) );
+        BOOST_REQUIRE( !pkeys[i]->VerifySig( hashes[( i + 1 ) % num_signed], sig_shares[i].sig ) ||
+                       num_signed == 1 );
+    }
+
+    // value shares match the shared_ptr API including the hint
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( hashes[i] );
+        auto sig_share = keys->first->at( i )->sign( hash_ptr, i + 1 );
+        BOOST_REQUIRE( *sig_share->getSigShare() == sig_shares[i].sig );
+        BOOST_REQUIRE( sig_share->getHint() ==
+                       libBLS::ThresholdUtils::fieldElementToString( sig_shares[i].hintY ) + ":" +
+                           std::to_string( sig_shares[i].hintCounter ) );
+    }
+
+    auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >( hashes[0] );
+    BLSSigShareSet sig_set( num_signed, num_all );
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        sig_set.addSigShare( keys->first->at( i )->sign( hash_ptr, i + 1 ) );
+    }
+    libff::alt_bn128_G1 common_sig = *sig_set.merge()->getSig();
+
+    BOOST_REQUIRE( common_pkey.VerifySig( hashes[0], common_sig ) );
+
+    BOOST_REQUIRE_THROW( common_pkey.VerifySig( hashes[0], libff::alt_bn128_G1::zero() ),
+        libBLS::ThresholdUtils::IsNotWellFormed );
+
+    std::cout << "DONE\n";
+}
+
 BOOST_AUTO_TEST_CASE( Exceptions ) {
     size_t num_all = rand_gen() % 15 + 2;
     size_t num_signed = rand_gen() % ( num_all - 1 ) + 1;
@@ -1413,4 +1986,74 @@ BOOST_AUTO_TEST_CASE( DKGWrappersExceptions ) {
             libBLS::ThresholdUtils::IncorrectInput );
     }
 }
+
+BOOST_AUTO_TEST_CASE( DKGWrapperPublicSharesCache ) {
+    size_t num_all = rand_gen() % 15 + 2;
+    size_t num_signed = rand_gen() % ( num_all - 1 ) + 1;
+
+    DKGBLSWrapper dkg_wrap( num_signed, num_all );
+    auto public_shares = dkg_wrap.createDKGPublicShares();
+    BOOST_REQUIRE( public_shares->size() == num_signed );
+    BOOST_REQUIRE( *dkg_wrap.createDKGPublicShares() == *public_shares );
+    BOOST_REQUIRE( public_shares->at( 0 ) ==
+                   libBLS::ThresholdUtils::mulGenerator( dkg_wrap.getValueAt0() ) );
+
+    // a new polynomial replaces the cached verification vector
+    libBLS::Dkg dkg( num_signed, num_all );
+    auto poly = std::make_shared< std::vector< libff::alt_bn128_Fr > >( dkg.GeneratePolynomial() );
+    dkg_wrap.setDKGSecret( poly );
+    BOOST_REQUIRE( *dkg_wrap.createDKGPublicShares() == dkg.VerificationVector( *poly ) );
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        BOOST_REQUIRE( dkg_wrap.createDKGPublicShares()->at( i ) ==
+                       libBLS::ThresholdUtils::mulGenerator( poly->at( i ) ) );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( DKGWrapperAccumulator ) {
+    size_t num_all = rand_gen() % 15 + 2;
+    size_t num_signed = rand_gen() % num_all + 1;
+
+    std::vector< DKGBLSWrapper > dkgs;
+    std::vector< std::shared_ptr< libBLS::DkgAccumulator > > accumulators;
+    for ( size_t i = 0; i < num_all; i++ ) {
+        dkgs.emplace_back( num_signed, num_all );
+        accumulators.push_back(
+            std::make_shared< libBLS::DkgAccumulator >( i, num_signed, num_all ) );
+    }
+
+    // every dealer's message is accumulated by every node as soon as it is broadcast
+    for ( size_t j = 0; j < num_all; j++ ) {
+        auto secret_shares = dkgs.at( j ).createDKGSecretShares();
+        auto public_shares = dkgs.at( j ).createDKGPublicShares();
+        for ( size_t i = 0; i < num_all; i++ ) {
+            BOOST_REQUIRE(
+                accumulators.at( i )->addDealer( j, secret_shares->at( i ), *public_shares ) );
+        }
+    }
+
+    BLSPublicKey common_pkey =
+        DKGBLSWrapper::CreateBLSPublicKey( *accumulators.at( 0 ), num_signed, num_all );
+
+    std::shared_ptr< std::array< uint8_t, 32 > > hash_ptr =
+        std::make_shared< std::array< uint8_t, 32 > >( GenerateRandHash() );
+
+    BLSSigShareSet sigSet( num_signed, num_all );
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        BLSPrivateKeyShare skey = dkgs.at( i ).CreateBLSPrivateKeyShare( *accumulators.at( i ) );
+        BLSPublicKeyShare pkey_share(
+            accumulators.at( 0 )->getPublicKeyShare( i ), num_signed, num_all );
+        std::shared_ptr< BLSSigShare > sig_share = skey.sign( hash_ptr, i + 1 );
+        BOOST_REQUIRE( pkey_share.VerifySig( hash_ptr, sig_share, num_signed, num_all ) );
+        sigSet.addSigShare( sig_share );
+    }
+
+    BOOST_REQUIRE( common_pkey.VerifySig( hash_ptr, sigSet.merge() ) );
+
+    libBLS::DkgAccumulator wrong_accumulator( 0, num_signed, num_all + 1 );
+    BOOST_REQUIRE_THROW( dkgs.at( 0 ).CreateBLSPrivateKeyShare( wrong_accumulator ),
+        libBLS::ThresholdUtils::IncorrectInput );
+    BOOST_REQUIRE_THROW(
+        DKGBLSWrapper::CreateBLSPublicKey( wrong_accumulator, num_signed, num_all ),
+        libBLS::ThresholdUtils::IncorrectInput );
+}
 BOOST_AUTO_TEST_SUITE_END()
@@ -26,12 +26,15 @@
 #include <bls/BLSPublicKey.h>
 #include <bls/BLSSigShareSet.h>
 #include <bls/BLSSignature.h>
+#include <dkg/DkgAccumulator.h>
 #include <dkg/dkg.h>
+#include <tools/utils.h>
 
 #include <cstdlib>
 #include <ctime>
 #include <map>
 #include <set>
+#include <thread>
 
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
 #include <libff/algebra/exponentiation/exponentiation.hpp>
@@ -188,4 +191,233 @@ BOOST_AUTO_TEST_CASE( Verification2 ) {
     }
 }
 
+BOOST_AUTO_TEST_CASE( SecretKeyContribution ) {
+    for ( size_t i = 0; i < 10; i++ ) {
+        size_t num_all = rand_gen() % 64 + 1;
+        size_t num_signed = rand_gen() % num_all + 1;
+        libBLS::Dkg obj = libBLS::Dkg( num_signed, num_all );
+
+        std::vector< libff::alt_bn128_Fr > pol = obj.GeneratePolynomial();
+        std::vector< libff::alt_bn128_Fr > secret_shares = obj.SecretKeyContribution( pol );
+        BOOST_REQUIRE( secret_shares.size() == num_all );
+
+        for ( size_t j = 0; j < num_all; j++ ) {
+            libff::alt_bn128_Fr value = libff::alt_bn128_Fr::zero();
+            for ( size_t k = 0; k < num_signed; k++ ) {
+                value += pol[k] * power( libff::alt_bn128_Fr( j + 1 ), k );
+            }
+            BOOST_REQUIRE( secret_shares[j] == value );
+            BOOST_REQUIRE( obj.PolynomialValue( pol, j + 1 ) == value );
+        }
+
+        pol[num_signed - 1] = libff::alt_bn128_Fr::zero();
+        BOOST_REQUIRE_THROW( obj.SecretKeyContribution( pol ), std::logic_error );
+        pol.pop_back();
+        BOOST_REQUIRE_THROW(
+            obj.SecretKeyContribution( pol ), libBLS::ThresholdUtils::IncorrectInput );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( VerificationVectorObject ) {
+    for ( size_t i = 0; i < 10; i++ ) {
+        size_t num_all = rand_gen() % 16 + 1;
+        size_t num_signed = rand_gen() % num_all + 1;
+        libBLS::Dkg obj = libBLS::Dkg( num_signed, num_all );
+
+        std::vector< libff::alt_bn128_Fr > pol = obj.GeneratePolynomial();
+        std::vector< libff::alt_bn128_Fr > secret_shares = obj.SecretKeyContribution( pol );
+        std::vector< libff::alt_bn128_G2 > verif_vect = obj.VerificationVector( pol );
+        libBLS::VerificationVector commitments( verif_vect );
+        BOOST_REQUIRE( commitments.isValid() );
+        BOOST_REQUIRE( commitments.size() == num_signed );
+        BOOST_REQUIRE( commitments.getCommitments() == verif_vect );
+
+        libBLS::VerificationVector spoiled( SpoilVerifVector( verif_vect ) );
+        BOOST_REQUIRE( !spoiled.isValid() );
+
+        for ( size_t j = 0; j < num_all; j++ ) {
+            BOOST_REQUIRE( commitments.evaluate( j ) ==
+                           libBLS::ThresholdUtils::mulGenerator( secret_shares.at( j ) ) );
+            BOOST_REQUIRE( commitments.verify( j, secret_shares.at( j ) ) );
+            BOOST_REQUIRE( obj.Verification( j, secret_shares.at( j ), commitments ) );
+            BOOST_REQUIRE(
+                !commitments.verify( j, secret_shares.at( j ) + libff::alt_bn128_Fr::one() ) );
+            BOOST_REQUIRE( !spoiled.verify( j, secret_shares.at( j ) ) );
+        }
+    }
+}
+
+BOOST_AUTO_TEST_CASE( PublicKeyShares ) {
+    for ( size_t i = 0; i < 5; i++ ) {
+        size_t num_all = rand_gen() % 16 + 1;
+        size_t num_signed = rand_gen() % num_all + 1;
+        libBLS::Dkg obj = libBLS::Dkg( num_signed, num_all );
+
+        std::vector< std::vector< libff::alt_bn128_Fr > > secret_shares( num_all );
+        std::vector< std::vector< libff::alt_bn128_G2 > > verif_vects( num_all );
+        libff::alt_bn128_G2 common_public_key = libff::alt_bn128_G2::zero();
+        for ( size_t j = 0; j < num_all; j++ ) {
+            std::vector< libff::alt_bn128_Fr > pol = obj.GeneratePolynomial();
+            secret_shares[j] = obj.SecretKeyContribution( pol );
+            verif_vects[j] = obj.VerificationVector( pol );
+            common_public_key = common_public_key + verif_vects[j][0];
+        }
+
+        auto public_keys = obj.PublicKeyShares( verif_vects );
+        BOOST_REQUIRE( public_keys.first == common_public_key );
+        BOOST_REQUIRE( public_keys.second.size() == num_all );
+
+        for ( size_t j = 0; j < num_all; j++ ) {
+            std::vector< libff::alt_bn128_Fr > secret_key_contribution( num_all );
+            for ( size_t k = 0; k < num_all; k++ ) {
+                secret_key_contribution[k] = secret_shares[k][j];
+            }
+            libff::alt_bn128_Fr secret_key = obj.SecretKeyShareCreate( secret_key_contribution );
+            BOOST_REQUIRE(
+                public_keys.second[j] == obj.GetPublicKeyFromSecretKey( secret_key ) );
+        }
+
+        verif_vects.back().pop_back();
+        BOOST_REQUIRE_THROW(
+            obj.PublicKeyShares( verif_vects ), libBLS::ThresholdUtils::IncorrectInput );
+        verif_vects.pop_back();
+        BOOST_REQUIRE_THROW(
+            obj.PublicKeyShares( verif_vects ), libBLS::ThresholdUtils::IncorrectInput );
+    }
+}
+
+BOOST_AUTO_TEST_CASE( DkgAccumulator ) {
+    for ( size_t i = 0; i < 5; i++ ) {
+        size_t num_all = rand_gen() % 15 + 3;
+        size_t num_signed = rand_gen() % num_all + 1;
+        libBLS::Dkg obj = libBLS::Dkg( num_signed, num_all );
+
+        std::vector< std::vector< libff::alt_bn128_Fr > > secret_shares( num_all );
+        std::vector< std::vector< libff::alt_bn128_G2 > > verif_vects( num_all );
+        for ( size_t j = 0; j < num_all; j++ ) {
+            std::vector< libff::alt_bn128_Fr > pol = obj.GeneratePolynomial();
+            secret_shares[j] = obj.SecretKeyContribution( pol );
+            verif_vects[j] = obj.VerificationVector( pol );
+        }
+
+        size_t idx = rand_gen() % num_all;
+        libBLS::DkgAccumulator accumulator( idx, num_signed, num_all );
+
+        // the last dealer cheats, the others arrive from several threads
+        BOOST_REQUIRE( !accumulator.addDealer( num_all - 1,
+            secret_shares[num_all - 1][idx] + libff::alt_bn128_Fr::one(),
+            verif_vects[num_all - 1] ) );
+
+        std::vector< char > added( num_all - 1 );
+        std::vector< std::thread > threads;
+        for ( size_t j = 0; j + 1 < num_all; j++ ) {
+            threads.emplace_back( [&, j]() {
+                added[j] = accumulator.addDealer( j, secret_shares[j][idx], verif_vects[j] );
+            } );
+        }
+        for ( auto& thread : threads ) {
+            thread.join();
+        }
+        for ( size_t j = 0; j + 1 < num_all; j++ ) {
+            BOOST_REQUIRE( added[j] );
+        }
+
+        BOOST_REQUIRE( accumulator.getDealersCount() == num_all - 1 );
+        BOOST_REQUIRE( !accumulator.hasDealer( num_all - 1 ) );
+        BOOST_REQUIRE_THROW( accumulator.addDealer( 0, secret_shares[0][idx], verif_vects[0] ),
+            libBLS::ThresholdUtils::IncorrectInput );
+
+        std::vector< std::vector< libff::alt_bn128_G2 > > qualified_vects(
+            verif_vects.begin(), verif_vects.end() - 1 );
+        libBLS::Dkg qualified = libBLS::Dkg( num_signed, num_all - 1 );
+        BOOST_REQUIRE( accumulator.getAggregateVerificationVector() ==
+                       qualified.AggregateVerificationVectors( qualified_vects ) );
+
+        libff::alt_bn128_Fr secret_key = libff::alt_bn128_Fr::zero();
+        for ( size_t j = 0; j + 1 < num_all; j++ ) {
+            secret_key += secret_shares[j][idx];
+        }
+        BOOST_REQUIRE( accumulator.getSecretKeyShare() == secret_key );
+        BOOST_REQUIRE( accumulator.getPublicKeyShare( idx ) ==
+                       libBLS::ThresholdUtils::mulGenerator( secret_key ) );
+
+        // a removal must come with what the dealer was added with, even if it verifies
+        BOOST_REQUIRE_THROW( accumulator.removeDealer( 0,
+                                 secret_shares[0][idx] + libff::alt_bn128_Fr::one(),
+                                 verif_vects[0] ),
+            libBLS::ThresholdUtils::IncorrectInput );
+        BOOST_REQUIRE_THROW(
+            accumulator.removeDealer( 0, secret_shares[1][idx], verif_vects[1] ),
+            libBLS::ThresholdUtils::IncorrectInput );
+        BOOST_REQUIRE( accumulator.hasDealer( 0 ) );
+        BOOST_REQUIRE( accumulator.getSecretKeyShare() == secret_key );
+
+        // a dealer taken out of the qualified set afterwards
+        accumulator.removeDealer( 0, secret_shares[0][idx], verif_vects[0] );
+        BOOST_REQUIRE( !accumulator.hasDealer( 0 ) );
+        BOOST_REQUIRE( accumulator.getSecretKeyShare() == secret_key - secret_shares[0][idx] );
+        BOOST_REQUIRE( accumulator.getPublicKeyShare( idx ) ==
+                       libBLS::ThresholdUtils::mulGenerator( secret_key - secret_shares[0][idx] ) );
+        BOOST_REQUIRE_THROW(
+            accumulator.removeDealer( 0, secret_shares[0][idx], verif_vects[0] ),
+            libBLS::ThresholdUtils::IncorrectInput );
+    }
+
+    BOOST_REQUIRE_THROW(
+        libBLS::DkgAccumulator( 3, 2, 3 ), libBLS::ThresholdUtils::IncorrectInput );
+    libBLS::DkgAccumulator accumulator( 0, 2, 3 );
+    BOOST_REQUIRE_THROW( accumulator.getSecretKeyShare(), libBLS::ThresholdUtils::IncorrectInput );
+    BOOST_REQUIRE_THROW( accumulator.addDealer( 0, libff::alt_bn128_Fr::one(), {} ),
+        libBLS::ThresholdUtils::IncorrectInput );
+}
+
+BOOST_AUTO_TEST_CASE( VerifyAll ) {
+    for ( size_t i = 0; i < 10; i++ ) {
+        size_t num_all = rand_gen() % 16 + 1;
+        size_t num_signed = rand_gen() % num_all + 1;
+        libBLS::Dkg obj = libBLS::Dkg( num_signed, num_all );
+
+        std::vector< std::vector< libff::alt_bn128_Fr > > secret_shares( num_all );
+        std::vector< std::vector< libff::alt_bn128_G2 > > verif_vects( num_all );
+        for ( size_t j = 0; j < num_all; j++ ) {
+            std::vector< libff::alt_bn128_Fr > pol = obj.GeneratePolynomial();
+            secret_shares[j] = obj.SecretKeyContribution( pol );
+            verif_vects[j] = obj.VerificationVector( pol );
+        }
+
+        size_t idx = rand_gen() % num_all;
+        std::vector< libff::alt_bn128_Fr > shares( num_all );
+        for ( size_t j = 0; j < num_all; j++ ) {
+            shares[j] = secret_shares[j][idx];
+        }
+
+        BOOST_REQUIRE( obj.VerifyAll( idx, shares, verif_vects ).empty() );
+
+        // dealers that cheat with their shares or their verification vectors are all found
+        std::set< size_t > cheaters;
+        for ( size_t j = 0; j < num_all; j++ ) {
+            if ( rand_gen() % 3 == 0 ) {
+                cheaters.insert( j );
+                if ( rand_gen() % 2 == 0 ) {
+                    shares[j] = shares[j] + libff::alt_bn128_Fr::one();
+                } else {
+                    verif_vects[j] = SpoilVerifVector( verif_vects[j] );
+                }
+            }
+        }
+
+        std::vector< size_t > failed = obj.VerifyAll( idx, shares, verif_vects );
+        BOOST_REQUIRE( std::set< size_t >( failed.begin(), failed.end() ) == cheaters );
+        BOOST_REQUIRE( failed.size() == cheaters.size() );
+        for ( size_t j = 0; j < num_all; j++ ) {
+            BOOST_REQUIRE(
+                obj.Verification( idx, shares[j], verif_vects[j] ) == !cheaters.count( j ) );
+        }
+    }
+
+    libBLS::Dkg obj = libBLS::Dkg( 2, 3 );
+    BOOST_REQUIRE_THROW( obj.VerifyAll( 0, { libff::alt_bn128_Fr::one() }, {} ),
+        libBLS::ThresholdUtils::IncorrectInput );
+}
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -25,11 +25,13 @@
 #include <ctime>
 #include <map>
 #include <set>
+#include <thread>
 
 #include <bls/bls.h>
 
 #include <tools/utils.h>
 
+#include <libff/common/profiling.hpp>
 #include <openssl/rand.h>
 
 
@@ -104,6 +106,59 @@ BOOST_AUTO_TEST_CASE( RandomPolynomial ) {
     BOOST_REQUIRE( value_at_zero_point == obj.KeysRecover( coeffs, values ).first );
 }
 
+BOOST_AUTO_TEST_CASE( LagrangeCoeffsCacheHits ) {
+    std::cout << "Testing LagrangeCoeffsCache\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    libBLS::LagrangeCoeffsCache cache( 2 );
+
+    // the same signer set in a different order with an extra signer after the first t
+    std::vector< size_t > first = { 7, 2, 11, 5 };
+    std::vector< size_t > second = { 11, 5, 2, 7, 3 };
+
+    auto first_coeffs = cache.get( first, 4 );
+    BOOST_REQUIRE( first_coeffs == libBLS::ThresholdUtils::LagrangeCoeffs( first, 4 ) );
+    BOOST_REQUIRE( cache.getHits() == 0 && cache.getMisses() == 1 );
+
+    auto second_coeffs = cache.get( second, 4 );
+    BOOST_REQUIRE( second_coeffs == libBLS::ThresholdUtils::LagrangeCoeffs( second, 4 ) );
+    BOOST_REQUIRE( cache.getHits() == 1 && cache.getMisses() == 1 );
+
+    // coefficients of any set sum up to one, as they interpolate a constant
+    libff::alt_bn128_Fr sum = libff::alt_bn128_Fr::zero();
+    for ( const auto& coeff : second_coeffs ) {
+        sum += coeff;
+    }
+    BOOST_REQUIRE( sum == libff::alt_bn128_Fr::one() );
+
+    cache.get( { 1, 2, 3, 4 }, 4 );
+    cache.get( { 1, 2, 3, 5 }, 4 );
+    cache.get( first, 4 );
+    BOOST_REQUIRE( cache.getHits() == 1 && cache.getMisses() == 4 );
+
+    // indexes above the bitmap limit are computed directly
+    std::vector< size_t > large = { 1, LAGRANGE_COEFFS_CACHE_MAX_INDEX + 1 };
+    BOOST_REQUIRE( cache.get( large, 2 ) == libBLS::ThresholdUtils::LagrangeCoeffs( large, 2 ) );
+    BOOST_REQUIRE( cache.getHits() == 1 && cache.getMisses() == 4 );
+
+    BOOST_REQUIRE_THROW( cache.get( { 1, 2, 2 }, 3 ), libBLS::ThresholdUtils::IncorrectInput );
+
+    // duplicate and zero indexes are rejected even when the same signer bitmap is cached
+    cache.get( { 1, 2 }, 2 );
+    BOOST_REQUIRE_THROW( cache.get( { 1, 2, 2 }, 3 ), libBLS::ThresholdUtils::IncorrectInput );
+    BOOST_REQUIRE_THROW( cache.get( { 2, 1, 1 }, 3 ), libBLS::ThresholdUtils::IncorrectInput );
+    cache.get( { 1, 2 }, 2 );
+    BOOST_REQUIRE_THROW( cache.get( { 0, 1, 2 }, 3 ), libBLS::ThresholdUtils::IncorrectInput );
+    BOOST_REQUIRE(
+        cache.get( { 2, 1 }, 2 ) == libBLS::ThresholdUtils::LagrangeCoeffs( { 2, 1 }, 2 ) );
+    BOOST_REQUIRE_THROW( cache.get( { 1, 2 }, 3 ), libBLS::ThresholdUtils::IncorrectInput );
+    BOOST_REQUIRE_THROW( libBLS::ThresholdUtils::LagrangeCoeffs( { 0, 1 }, 2 ),
+        libBLS::ThresholdUtils::IncorrectInput );
+
+    std::cout << "DONE\n";
+}
+
 BOOST_AUTO_TEST_SUITE_END()
 
 BOOST_AUTO_TEST_SUITE( TestAES )
@@ -161,3 +216,499 @@ BOOST_AUTO_TEST_CASE( wrongKey ) {
 }
 
 BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE( TestPairing )
+
+BOOST_AUTO_TEST_CASE( CheckPairingMatchesReducedPairing ) {
+    std::cout << "Testing CheckPairing\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    for ( size_t i = 0; i < 5; ++i ) {
+        libff::alt_bn128_Fr secret_key = libff::alt_bn128_Fr::random_element();
+        libff::alt_bn128_G2 public_key = secret_key * libff::alt_bn128_G2::one();
+        libff::alt_bn128_G1 hash = libff::alt_bn128_G1::random_element();
+        libff::alt_bn128_G1 signature = secret_key * hash;
+
+        BOOST_REQUIRE( libff::alt_bn128_ate_reduced_pairing( signature,
+                           libff::alt_bn128_G2::one() ) ==
+                       libff::alt_bn128_ate_reduced_pairing( hash, public_key ) );
+        BOOST_REQUIRE( libBLS::ThresholdUtils::CheckPairing( signature, hash, public_key ) );
+
+        BOOST_REQUIRE( !libBLS::ThresholdUtils::CheckPairing(
+            signature + libff::alt_bn128_G1::one(), hash, public_key ) );
+        BOOST_REQUIRE( !libBLS::ThresholdUtils::CheckPairing(
+            signature, hash + libff::alt_bn128_G1::one(), public_key ) );
+        BOOST_REQUIRE( !libBLS::ThresholdUtils::CheckPairing(
+            signature, hash, public_key + libff::alt_bn128_G2::one() ) );
+    }
+
+    BOOST_REQUIRE( !libBLS::ThresholdUtils::CheckPairing( libff::alt_bn128_G1::zero(),
+        libff::alt_bn128_G1::one(), libff::alt_bn128_G2::zero() ) );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( ConstantTimeMulMatchesScalarMul ) {
+    std::cout << "Testing ConstantTimeMul\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    std::vector< libff::alt_bn128_Fr > scalars = { libff::alt_bn128_Fr::zero(),
+        libff::alt_bn128_Fr::one(), libff::alt_bn128_Fr( 2 ), -libff::alt_bn128_Fr::one(),
+        -libff::alt_bn128_Fr( 2 ) };
+    for ( size_t i = 0; i < 10; ++i ) {
+        scalars.push_back( libff::alt_bn128_Fr::random_element() );
+    }
+
+    for ( const auto& scalar : scalars ) {
+        libff::alt_bn128_G1 point = libff::alt_bn128_G1::random_element();
+        BOOST_REQUIRE( libBLS::ThresholdUtils::ConstantTimeMul( scalar, point ) == scalar * point );
+    }
+
+    BOOST_REQUIRE( libBLS::ThresholdUtils::ConstantTimeMul(
+        libff::alt_bn128_Fr::random_element(), libff::alt_bn128_G1::zero() )
+                       .is_zero() );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( MulGeneratorMatchesScalarMul ) {
+    std::cout << "Testing mulGenerator\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    std::vector< libff::alt_bn128_Fr > scalars = { libff::alt_bn128_Fr::one(),
+        libff::alt_bn128_Fr( 2 ), -libff::alt_bn128_Fr::one(), -libff::alt_bn128_Fr( 2 ) };
+    for ( size_t i = 0; i < 10; ++i ) {
+        scalars.push_back( libff::alt_bn128_Fr::random_element() );
+    }
+
+    for ( const auto& scalar : scalars ) {
+        BOOST_REQUIRE( libBLS::ThresholdUtils::mulGenerator( scalar ) ==
+                       scalar * libff::alt_bn128_G2::one() );
+    }
+
+    BOOST_REQUIRE( libBLS::ThresholdUtils::mulGenerator( libff::alt_bn128_Fr::zero() ).is_zero() );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( MultiMillerLoopMatchesReducedPairings ) {
+    std::cout << "Testing MultiMillerLoop\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    size_t num_pairs = 7;
+    std::vector< libff::alt_bn128_G1 > points( num_pairs );
+    std::vector< libff::alt_bn128_ate_G2_precomp > precomps( num_pairs );
+    std::vector< const libff::alt_bn128_ate_G2_precomp* > precomp_ptrs( num_pairs );
+    libff::alt_bn128_GT expected = libff::alt_bn128_GT::one();
+
+    for ( size_t i = 0; i < num_pairs; ++i ) {
+        points[i] = i == 3 ? libff::alt_bn128_G1::zero() : libff::alt_bn128_G1::random_element();
+        libff::alt_bn128_G2 q = libff::alt_bn128_G2::random_element();
+        precomps[i] = libff::alt_bn128_ate_precompute_G2( q );
+        precomp_ptrs[i] = &precomps[i];
+
+        if ( !points[i].is_zero() ) {
+            expected = expected * libff::alt_bn128_ate_reduced_pairing( points[i], q );
+        }
+    }
+
+    libff::alt_bn128_Fq12 miller_loop =
+        libBLS::ThresholdUtils::MultiMillerLoop( points, precomp_ptrs );
+    BOOST_REQUIRE( libff::alt_bn128_final_exponentiation( miller_loop ) == expected );
+
+    BOOST_REQUIRE( libBLS::ThresholdUtils::MultiMillerLoop( {}, {} ) ==
+                   libff::alt_bn128_Fq12::one() );
+
+    precomp_ptrs.pop_back();
+    BOOST_REQUIRE_THROW( libBLS::ThresholdUtils::MultiMillerLoop( points, precomp_ptrs ),
+        libBLS::ThresholdUtils::IncorrectInput );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+// try-and-increment hashing with a separate Euler criterion check and square root,
+// HashtoG1WithCounter must give the same points and counters
+std::pair< libff::alt_bn128_G1, uint64_t > LegacyHashtoG1(
+    std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr ) {
+    libff::alt_bn128_Fq x1( libBLS::ThresholdUtils::HashToFq( hash_byte_arr ) );
+    uint64_t counter = 0;
+
+    while ( true ) {
+        libff::alt_bn128_Fq y1_sqr = ( x1 ^ 3 ) + libff::alt_bn128_coeff_b;
+        libff::alt_bn128_Fq euler = y1_sqr ^ libff::alt_bn128_Fq::euler;
+
+        if ( euler == libff::alt_bn128_Fq::one() || euler == libff::alt_bn128_Fq::zero() ) {
+            libff::alt_bn128_Fq temp_y = y1_sqr.sqrt();
+
+            mpz_t pos_y;
+            mpz_init( pos_y );
+            temp_y.as_bigint().to_mpz( pos_y );
+
+            mpz_t neg_y;
+            mpz_init( neg_y );
+            ( -temp_y ).as_bigint().to_mpz( neg_y );
+
+            if ( mpz_cmp( pos_y, neg_y ) < 0 ) {
+                temp_y = -temp_y;
+            }
+
+            mpz_clear( pos_y );
+            mpz_clear( neg_y );
+
+            return { libff::alt_bn128_G1( x1, temp_y, libff::alt_bn128_Fq::one() ), counter };
+        }
+
+        x1 = x1 + libff::alt_bn128_Fq::one();
+        ++counter;
+    }
+}
+
+BOOST_AUTO_TEST_SUITE( TestHashing )
+
+BOOST_AUTO_TEST_CASE( HashtoG1MatchesEulerCriterion ) {
+    std::cout << "Testing HashtoG1WithCounter\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    for ( size_t i = 0; i < 100; ++i ) {
+        auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >();
+        BOOST_REQUIRE( RAND_bytes( hash_ptr->data(), 32 ) == 1 );
+
+        auto expected = LegacyHashtoG1( hash_ptr );
+        auto point = libBLS::ThresholdUtils::HashtoG1WithCounter( hash_ptr );
+
+        BOOST_REQUIRE( point.first.X == expected.first.X );
+        BOOST_REQUIRE( point.first.Y == expected.first.Y );
+        BOOST_REQUIRE( point.first.Z == libff::alt_bn128_Fq::one() );
+        BOOST_REQUIRE( point.second == expected.second );
+        BOOST_REQUIRE( point.first.is_well_formed() );
+
+        BOOST_REQUIRE( libBLS::ThresholdUtils::HashtoG1( hash_ptr ) == point.first );
+
+        auto with_hint = libBLS::Bls::HashtoG1withHint( hash_ptr );
+        BOOST_REQUIRE( with_hint.first == point.first );
+        BOOST_REQUIRE( with_hint.second == std::to_string( expected.second ) );
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( HashToG1CacheHitsAndEviction ) {
+    std::cout << "Testing HashToG1Cache\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    // one entry per shard, hashes starting with 0 and 16 go to the same shard
+    libBLS::HashToG1Cache cache( 16 );
+
+    auto first_hash = std::make_shared< std::array< uint8_t, 32 > >();
+    auto second_hash = std::make_shared< std::array< uint8_t, 32 > >();
+    BOOST_REQUIRE( RAND_bytes( first_hash->data(), 32 ) == 1 );
+    BOOST_REQUIRE( RAND_bytes( second_hash->data(), 32 ) == 1 );
+    first_hash->at( 0 ) = 0;
+    second_hash->at( 0 ) = 16;
+
+    auto expected = libBLS::ThresholdUtils::HashtoG1WithCounter( first_hash );
+
+    auto point = cache.get( first_hash );
+    BOOST_REQUIRE( point.first == expected.first && point.second == expected.second );
+    BOOST_REQUIRE( cache.getHits() == 0 && cache.getMisses() == 1 );
+
+    point = cache.get( first_hash );
+    BOOST_REQUIRE( point.first == expected.first && point.second == expected.second );
+    BOOST_REQUIRE( cache.getHits() == 1 && cache.getMisses() == 1 );
+
+    cache.get( second_hash );
+    BOOST_REQUIRE( cache.getHits() == 1 && cache.getMisses() == 2 );
+
+    point = cache.get( first_hash );
+    BOOST_REQUIRE( point.first == expected.first && point.second == expected.second );
+    BOOST_REQUIRE( cache.getHits() == 1 && cache.getMisses() == 3 );
+
+    BOOST_REQUIRE_THROW( cache.get( nullptr ), libBLS::ThresholdUtils::IncorrectInput );
+
+    auto& instance = libBLS::HashToG1Cache::getInstance();
+    uint64_t hits = instance.getHits();
+    libBLS::ThresholdUtils::HashtoG1( first_hash );
+    libBLS::Bls::HashtoG1withHint( first_hash );
+    BOOST_REQUIRE( instance.getHits() >= hits + 1 );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE( TestMultiScalarMul )
+
+template < class T >
+T NaiveMultiScalarMul(
+    const std::vector< libff::alt_bn128_Fr >& scalars, const std::vector< T >& points ) {
+    T sum = T::zero();
+    for ( size_t i = 0; i < points.size(); ++i ) {
+        sum = sum + scalars[i] * points[i];
+    }
+    return sum;
+}
+
+template < class T >
+void CheckMultiScalarMul( size_t num_points ) {
+    std::vector< libff::alt_bn128_Fr > scalars( num_points );
+    std::vector< T > points( num_points );
+    for ( size_t i = 0; i < num_points; ++i ) {
+        scalars[i] = i % 10 == 3 ? libff::alt_bn128_Fr::zero() :
+                                   libff::alt_bn128_Fr::random_element();
+        points[i] = i % 10 == 7 ? T::zero() : T::random_element();
+        if ( i % 2 == 0 ) {
+            points[i].to_affine_coordinates();
+        }
+    }
+
+    BOOST_REQUIRE( libBLS::ThresholdUtils::MultiScalarMul( scalars, points ) ==
+                   NaiveMultiScalarMul( scalars, points ) );
+}
+
+BOOST_AUTO_TEST_CASE( MultiScalarMulMatchesNaiveSum ) {
+    std::cout << "Testing MultiScalarMul\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    for ( size_t num_points : { 0, 1, 2, 16, 86 } ) {
+        CheckMultiScalarMul< libff::alt_bn128_G1 >( num_points );
+        CheckMultiScalarMul< libff::alt_bn128_G2 >( num_points );
+    }
+
+    // small scalars use narrower windows over fewer bits
+    std::vector< libff::bigint< 2 > > small_scalars( 5 );
+    std::vector< libff::alt_bn128_G1 > points( 5 );
+    libff::alt_bn128_G1 expected = libff::alt_bn128_G1::zero();
+    for ( size_t i = 0; i < 5; ++i ) {
+        small_scalars[i] = libff::bigint< 2 >( 1000 * i + 1 );
+        points[i] = libff::alt_bn128_G1::random_element();
+        expected = expected + small_scalars[i] * points[i];
+    }
+    BOOST_REQUIRE( libBLS::ThresholdUtils::MultiScalarMul( small_scalars, points ) == expected );
+
+    BOOST_REQUIRE_THROW( libBLS::ThresholdUtils::MultiScalarMul(
+                             std::vector< libff::alt_bn128_Fr >( 2 ), points ),
+        libBLS::ThresholdUtils::IncorrectInput );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_CASE( FixedBaseTableMatchesScalarMul ) {
+    std::cout << "Testing G1FixedBaseTable\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    for ( size_t i = 0; i < 10; ++i ) {
+        libff::alt_bn128_G1 point = libff::alt_bn128_G1::random_element();
+        libBLS::G1FixedBaseTable table( point );
+
+        for ( auto scalar : { libff::alt_bn128_Fr::zero(), libff::alt_bn128_Fr::one(),
+                  -libff::alt_bn128_Fr::one(), libff::alt_bn128_Fr::random_element() } ) {
+            BOOST_REQUIRE( table.mul( scalar ) == scalar * point );
+        }
+    }
+
+    libBLS::G1FixedBaseTable zero_table( libff::alt_bn128_G1::zero() );
+    BOOST_REQUIRE( zero_table.mul( libff::alt_bn128_Fr::random_element() ).is_zero() );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE( TestBinaryFormat )
+
+BOOST_AUTO_TEST_CASE( CompressedPointsRoundTrip ) {
+    std::cout << "Testing compressed binary encoding\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    for ( size_t i = 0; i < 20; ++i ) {
+        libff::alt_bn128_G1 g1 = libff::alt_bn128_G1::random_element();
+        auto g1_bytes = libBLS::ThresholdUtils::G1ToBytes( g1 );
+        BOOST_REQUIRE( libBLS::ThresholdUtils::G1FromBytes( g1_bytes ) == g1 );
+        // the negated point differs only in the sign flag
+        auto neg_bytes = libBLS::ThresholdUtils::G1ToBytes( -g1 );
+        BOOST_REQUIRE( ( neg_bytes[0] ^ g1_bytes[0] ) == 0x40 );
+        BOOST_REQUIRE( std::equal( neg_bytes.begin() + 1, neg_bytes.end(), g1_bytes.begin() + 1 ) );
+        BOOST_REQUIRE( libBLS::ThresholdUtils::G1FromBytes( neg_bytes ) == -g1 );
+
+        libff::alt_bn128_G2 g2 = libff::alt_bn128_G2::random_element();
+        auto g2_bytes = libBLS::ThresholdUtils::G2ToBytes( g2 );
+        BOOST_REQUIRE( libBLS::ThresholdUtils::G2FromBytes( g2_bytes ) == g2 );
+        BOOST_REQUIRE( libBLS::ThresholdUtils::G2FromBytes(
+                           libBLS::ThresholdUtils::G2ToBytes( -g2 ) ) == -g2 );
+
+        libff::alt_bn128_Fr fr = libff::alt_bn128_Fr::random_element();
+        BOOST_REQUIRE( libBLS::ThresholdUtils::FrFromBytes(
+                           libBLS::ThresholdUtils::FrToBytes( fr ) ) == fr );
+    }
+
+    auto zero_g1 = libBLS::ThresholdUtils::G1ToBytes( libff::alt_bn128_G1::zero() );
+    BOOST_REQUIRE( zero_g1[0] == 0x80 );
+    BOOST_REQUIRE( libBLS::ThresholdUtils::G1FromBytes( zero_g1 ).is_zero() );
+    auto zero_g2 = libBLS::ThresholdUtils::G2ToBytes( libff::alt_bn128_G2::zero() );
+    BOOST_REQUIRE( libBLS::ThresholdUtils::G2FromBytes( zero_g2 ).is_zero() );
+    BOOST_REQUIRE( libBLS::ThresholdUtils::FrFromBytes( libBLS::ThresholdUtils::FrToBytes(
+                       libff::alt_bn128_Fr::zero() ) ) == libff::alt_bn128_Fr::zero() );
+
+    // infinity with a sign flag or non-zero coordinates is rejected
+    zero_g1[0] |= 0x40;
+    BOOST_REQUIRE_THROW( libBLS::ThresholdUtils::G1FromBytes( zero_g1 ),
+        libBLS::ThresholdUtils::IsNotWellFormed );
+    zero_g2[63] = 1;
+    BOOST_REQUIRE_THROW( libBLS::ThresholdUtils::G2FromBytes( zero_g2 ),
+        libBLS::ThresholdUtils::IsNotWellFormed );
+
+    // values not below the modulus are rejected
+    std::array< uint8_t, BLS_FR_BYTES > unreduced;
+    unreduced.fill( 0x3f );
+    BOOST_REQUIRE_THROW(
+        libBLS::ThresholdUtils::FrFromBytes( unreduced ), libBLS::ThresholdUtils::IncorrectInput );
+    std::array< uint8_t, BLS_G1_BYTES > unreduced_g1;
+    unreduced_g1.fill( 0x3f );
+    BOOST_REQUIRE_THROW( libBLS::ThresholdUtils::G1FromBytes( unreduced_g1 ),
+        libBLS::ThresholdUtils::IncorrectInput );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE( TestBinaryFormatVectors )
+
+std::string ToHex( const uint8_t* bytes, size_t size ) {
+    static const char digits[] = "0123456789abcdef";
+    std::string hex;
+    for ( size_t i = 0; i < size; ++i ) {
+        hex += digits[bytes[i] >> 4];
+        hex += digits[bytes[i] & 0xf];
+    }
+    return hex;
+}
+
+BOOST_AUTO_TEST_CASE( FixedVectors ) {
+    std::cout << "Testing binary encoding of known values\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    // the encoding must not depend on the limb size of GMP
+    auto g1 = libBLS::ThresholdUtils::G1ToBytes( libff::alt_bn128_G1::one() );
+    BOOST_REQUIRE( ToHex( g1.data(), g1.size() ) ==
+                   "0000000000000000000000000000000000000000000000000000000000000001" );
+    auto neg_g1 = libBLS::ThresholdUtils::G1ToBytes( -libff::alt_bn128_G1::one() );
+    BOOST_REQUIRE( ToHex( neg_g1.data(), neg_g1.size() ) ==
+                   "4000000000000000000000000000000000000000000000000000000000000001" );
+
+    auto g2 = libBLS::ThresholdUtils::G2ToBytes( libff::alt_bn128_G2::one() );
+    BOOST_REQUIRE( ToHex( g2.data(), g2.size() ) ==
+                   "198e9393920d483a7260bfb731fb5d25f1aa493335a9e71297e485b7aef312c2"
+                   "1800deef121f1e76426a00665e5c4479674322d4f75edadd46debd5cd992f6ed" );
+    BOOST_REQUIRE( libBLS::ThresholdUtils::G2FromBytes( g2 ) == libff::alt_bn128_G2::one() );
+
+    // 0x0102...1f20
+    libff::alt_bn128_Fr fr_value(
+        "455867356320691211509944977504407603390036387149619137164185182714736811808" );
+    auto fr = libBLS::ThresholdUtils::FrToBytes( fr_value );
+    BOOST_REQUIRE( ToHex( fr.data(), fr.size() ) ==
+                   "0102030405060708090a0b0c0d0e0f101112131415161718191a1b1c1d1e1f20" );
+
+    auto hint = libBLS::ThresholdUtils::HintToBytes( "5:72623859790382856" );
+    BOOST_REQUIRE( ToHex( hint.data(), hint.size() ) ==
+                   "0000000000000000000000000000000000000000000000000000000000000005"
+                   "0102030405060708" );
+    BOOST_REQUIRE( libBLS::ThresholdUtils::HintFromBytes( hint ) == "5:72623859790382856" );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE( TestValidateKey )
+
+BOOST_AUTO_TEST_CASE( G2MembershipMatchesOrderCheck ) {
+    std::cout << "Testing G2 subgroup membership\n";
+
+    libBLS::ThresholdUtils::initCurve();
+
+    auto order_check = []( const libff::alt_bn128_G2& point ) {
+        return point.is_well_formed() &&
+               libff::alt_bn128_G2::order() * point == libff::alt_bn128_G2::zero();
+    };
+
+    for ( size_t i = 0; i < 10; ++i ) {
+        libff::alt_bn128_G2 point = libff::alt_bn128_G2::random_element();
+        BOOST_REQUIRE( order_check( point ) );
+        BOOST_REQUIRE( libBLS::ThresholdUtils::ValidateKey( point ) );
+    }
+    BOOST_REQUIRE( libBLS::ThresholdUtils::ValidateKey( libff::alt_bn128_G2::zero() ) );
+
+    // points on the twist decoded from random x coordinates are almost never in G2
+    size_t outside = 0;
+    while ( outside < 10 ) {
+        std::array< uint8_t, BLS_G2_BYTES > bytes;
+        for ( auto& byte : bytes ) {
+            byte = std::rand() % 256;
+        }
+        bytes[0] &= 0x1f;
+        bytes[32] &= 0x1f;
+
+        libff::alt_bn128_G2 point;
+        try {
+            point = libBLS::ThresholdUtils::G2FromBytes( bytes );
+        } catch ( libBLS::ThresholdUtils::IsNotWellFormed& ) {
+            continue;
+        }
+
+        BOOST_REQUIRE( libBLS::ThresholdUtils::ValidateKey( point ) == order_check( point ) );
+        if ( !order_check( point ) ) {
+            ++outside;
+        }
+    }
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+
+BOOST_AUTO_TEST_SUITE( TestContext )
+
+BOOST_AUTO_TEST_CASE( ContextIsBuiltOnce ) {
+    std::cout << "Testing LibBLSContext\n";
+
+    std::vector< const libBLS::LibBLSContext* > contexts( 8 );
+    std::vector< std::thread > threads;
+    for ( size_t i = 0; i < contexts.size(); ++i ) {
+        threads.emplace_back( [&contexts, i]() { contexts[i] = &libBLS::LibBLSContext::get(); } );
+    }
+    for ( auto& thread : threads ) {
+        thread.join();
+    }
+
+    for ( const auto* context : contexts ) {
+        BOOST_REQUIRE( context == contexts[0] );
+    }
+    BOOST_REQUIRE( libBLS::ThresholdUtils::is_initialized );
+    BOOST_REQUIRE( libff::inhibit_profiling_counters );
+
+    libff::alt_bn128_Fq square = libff::alt_bn128_Fq::random_element().squared();
+    BOOST_REQUIRE( ( square ^ contexts[0]->getSqrtPower() ).squared() == square );
+
+    libff::alt_bn128_G1 point = libff::alt_bn128_G1::random_element();
+    BOOST_REQUIRE( libff::alt_bn128_final_exponentiation( libff::alt_bn128_ate_miller_loop(
+                       libff::alt_bn128_ate_precompute_G1( point ),
+                       contexts[0]->getG2GeneratorPrecomp() ) ) ==
+                   libff::alt_bn128_ate_reduced_pairing( point, libff::alt_bn128_G2::one() ) );
+
+    std::cout << "DONE\n";
+}
+
+BOOST_AUTO_TEST_SUITE_END()
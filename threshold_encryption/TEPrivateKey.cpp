@@ -33,7 +33,7 @@ TEPrivateKey::TEPrivateKey(
         throw libBLS::ThresholdUtils::IncorrectInput( "private key is null" );
     }
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     privateKey = libff::alt_bn128_Fr( _key_str->c_str() );
 
@@ -47,7 +47,7 @@ TEPrivateKey::TEPrivateKey(
     : privateKey( _skey ), requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
     libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     if ( _skey.is_zero() )
         throw libBLS::ThresholdUtils::IsNotWellFormed( "private key is zero" );
@@ -57,6 +57,27 @@ std::string TEPrivateKey::toString() const {
     return libBLS::ThresholdUtils::fieldElementToString( privateKey );
 }
 
+std::shared_ptr< std::vector< uint8_t > > TEPrivateKey::toBytes() const {
+    auto key_bytes = libBLS::ThresholdUtils::FrToBytes( privateKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_FR_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< TEPrivateKey > TEPrivateKey::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_FR_BYTES );
+
+    std::array< uint8_t, BLS_FR_BYTES > key_bytes;
+    std::copy( data, data + BLS_FR_BYTES, key_bytes.begin() );
+
+    return std::make_shared< TEPrivateKey >(
+        libBLS::ThresholdUtils::FrFromBytes( key_bytes ), _requiredSigners, _totalSigners );
+}
+
 libff::alt_bn128_Fr TEPrivateKey::getPrivateKey() const {
     return privateKey;
 }
@@ -41,6 +41,11 @@ public:
 
     std::string toString() const;
 
+    std::shared_ptr< std::vector< uint8_t > > toBytes() const;
+
+    static std::shared_ptr< TEPrivateKey > fromBytes(
+        const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners );
+
     libff::alt_bn128_Fr getPrivateKey() const;
 };
 
@@ -36,7 +36,7 @@ TEPrivateKeyShare::TEPrivateKeyShare( std::shared_ptr< std::string > _key_str, s
         throw libBLS::ThresholdUtils::IncorrectInput( "private key share is null" );
     }
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     privateKey = libff::alt_bn128_Fr( _key_str->c_str() );
 
@@ -57,7 +57,7 @@ TEPrivateKeyShare::TEPrivateKeyShare( libff::alt_bn128_Fr _skey_share, size_t _s
         throw libBLS::ThresholdUtils::IncorrectInput( "Wrong _signerIndex" );
     }
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     if ( _skey_share.is_zero() ) {
         throw libBLS::ThresholdUtils::ZeroSecretKey( "Zero private key share" );
@@ -82,6 +82,28 @@ std::string TEPrivateKeyShare::toString() const {
     return libBLS::ThresholdUtils::fieldElementToString( privateKey );
 }
 
+std::shared_ptr< std::vector< uint8_t > > TEPrivateKeyShare::toBytes() const {
+    auto key_bytes = libBLS::ThresholdUtils::FrToBytes( privateKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_FR_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< TEPrivateKeyShare > TEPrivateKeyShare::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t _signerIndex, size_t _requiredSigners,
+    size_t _totalSigners ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_FR_BYTES );
+
+    std::array< uint8_t, BLS_FR_BYTES > key_bytes;
+    std::copy( data, data + BLS_FR_BYTES, key_bytes.begin() );
+
+    return std::make_shared< TEPrivateKeyShare >( libBLS::ThresholdUtils::FrFromBytes( key_bytes ),
+        _signerIndex, _requiredSigners, _totalSigners );
+}
+
 size_t TEPrivateKeyShare::getSignerIndex() const {
     return signerIndex;
 }
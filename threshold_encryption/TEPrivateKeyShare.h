@@ -50,6 +50,11 @@ public:
 
     std::string toString() const;
 
+    std::shared_ptr< std::vector< uint8_t > > toBytes() const;
+
+    static std::shared_ptr< TEPrivateKeyShare > fromBytes( const std::vector< uint8_t >& bytes,
+        size_t _signerIndex, size_t _requiredSigners, size_t _totalSigners );
+
     size_t getSignerIndex() const;
 
     libff::alt_bn128_Fr getPrivateKey() const;
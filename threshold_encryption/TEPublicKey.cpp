@@ -50,7 +50,7 @@ TEPublicKey::TEPublicKey( std::shared_ptr< std::vector< std::string > > _key_str
             "non-digit symbol or first zero in non-zero public key share" );
     }
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     PublicKey.Z = libff::alt_bn128_Fq2::one();
     PublicKey.X.c0 = libff::alt_bn128_Fq( _key_str_ptr->at( 0 ).c_str() );
@@ -68,13 +68,13 @@ TEPublicKey::TEPublicKey(
     : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
     libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     if ( _common_private.getPrivateKey().is_zero() ) {
         throw libBLS::ThresholdUtils::ZeroSecretKey( "zero key" );
     }
 
-    PublicKey = _common_private.getPrivateKey() * libff::alt_bn128_G2::one();
+    PublicKey = libBLS::ThresholdUtils::mulGenerator( _common_private.getPrivateKey() );
 }
 
 TEPublicKey::TEPublicKey( libff::alt_bn128_G2 _pkey, size_t _requiredSigners, size_t _totalSigners )
@@ -109,6 +109,27 @@ std::shared_ptr< std::vector< std::string > > TEPublicKey::toString() {
         libBLS::ThresholdUtils::G2ToString( PublicKey ) );
 }
 
+std::shared_ptr< std::vector< uint8_t > > TEPublicKey::toBytes() const {
+    auto key_bytes = libBLS::ThresholdUtils::G2ToBytes( PublicKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_G2_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< TEPublicKey > TEPublicKey::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_G2_BYTES );
+
+    std::array< uint8_t, BLS_G2_BYTES > key_bytes;
+    std::copy( data, data + BLS_G2_BYTES, key_bytes.begin() );
+
+    return std::make_shared< TEPublicKey >(
+        libBLS::ThresholdUtils::G2FromBytes( key_bytes ), _requiredSigners, _totalSigners );
+}
+
 libff::alt_bn128_G2 TEPublicKey::getPublicKey() const {
     return PublicKey;
 }
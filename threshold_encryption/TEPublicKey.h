@@ -45,6 +45,11 @@ public:
 
     std::shared_ptr< std::vector< std::string > > toString();
 
+    std::shared_ptr< std::vector< uint8_t > > toBytes() const;
+
+    static std::shared_ptr< TEPublicKey > fromBytes(
+        const std::vector< uint8_t >& bytes, size_t _requiredSigners, size_t _totalSigners );
+
     libBLS::Ciphertext encrypt( std::shared_ptr< std::string > message );
 
     libff::alt_bn128_G2 getPublicKey() const;
@@ -49,7 +49,7 @@ TEPublicKeyShare::TEPublicKeyShare( std::shared_ptr< std::vector< std::string >
             "non-digit symbol or first zero in non-zero public key share" );
     }
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
     PublicKey.Z = libff::alt_bn128_Fq2::one();
     PublicKey.X.c0 = libff::alt_bn128_Fq( _key_str_ptr->at( 0 ).c_str() );
@@ -68,12 +68,27 @@ TEPublicKeyShare::TEPublicKeyShare(
     : requiredSigners( _requiredSigners ), totalSigners( _totalSigners ) {
     libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
 
-    libff::init_alt_bn128_params();
+    libBLS::ThresholdUtils::initCurve();
 
-    PublicKey = _p_key.getPrivateKey() * libff::alt_bn128_G2::one();
+    PublicKey = libBLS::ThresholdUtils::mulGenerator( _p_key.getPrivateKey() );
     signerIndex = _p_key.getSignerIndex();
 }
 
+TEPublicKeyShare::TEPublicKeyShare( libff::alt_bn128_G2 _pkey, size_t _signerIndex,
+    size_t _requiredSigners, size_t _totalSigners )
+    : PublicKey( _pkey ),
+      signerIndex( _signerIndex ),
+      requiredSigners( _requiredSigners ),
+      totalSigners( _totalSigners ) {
+    libBLS::ThresholdUtils::checkSigners( _requiredSigners, _totalSigners );
+
+    libBLS::ThresholdUtils::initCurve();
+
+    if ( _pkey.is_zero() || !_pkey.is_well_formed() ) {
+        throw libBLS::ThresholdUtils::IsNotWellFormed( "zero or corrupted public key share" );
+    }
+}
+
 bool TEPublicKeyShare::Verify(
     const libBLS::Ciphertext& cyphertext, const libff::alt_bn128_G2& decryptionShare ) {
     libBLS::TE::checkCypher( cyphertext );
@@ -91,6 +106,28 @@ std::shared_ptr< std::vector< std::string > > TEPublicKeyShare::toString() {
         libBLS::ThresholdUtils::G2ToString( PublicKey ) );
 }
 
+std::shared_ptr< std::vector< uint8_t > > TEPublicKeyShare::toBytes() const {
+    auto key_bytes = libBLS::ThresholdUtils::G2ToBytes( PublicKey );
+
+    auto ret = std::make_shared< std::vector< uint8_t > >( 1 + BLS_G2_BYTES );
+    ( *ret )[0] = BLS_BINARY_FORMAT_VERSION;
+    std::copy( key_bytes.begin(), key_bytes.end(), ret->begin() + 1 );
+
+    return ret;
+}
+
+std::shared_ptr< TEPublicKeyShare > TEPublicKeyShare::fromBytes(
+    const std::vector< uint8_t >& bytes, size_t _signerIndex, size_t _requiredSigners,
+    size_t _totalSigners ) {
+    const uint8_t* data = libBLS::ThresholdUtils::CheckBinaryFormat( bytes, BLS_G2_BYTES );
+
+    std::array< uint8_t, BLS_G2_BYTES > key_bytes;
+    std::copy( data, data + BLS_G2_BYTES, key_bytes.begin() );
+
+    return std::make_shared< TEPublicKeyShare >( libBLS::ThresholdUtils::G2FromBytes( key_bytes ),
+        _signerIndex, _requiredSigners, _totalSigners );
+}
+
 libff::alt_bn128_G2 TEPublicKeyShare::getPublicKey() const {
     return PublicKey;
 }
@@ -42,10 +42,18 @@ public:
 
     TEPublicKeyShare( TEPrivateKeyShare _p_key, size_t _requiredSigners, size_t _totalSigners );
 
+    TEPublicKeyShare( libff::alt_bn128_G2 _pkey, size_t _signerIndex, size_t _requiredSigners,
+        size_t _totalSigners );
+
     bool Verify( const libBLS::Ciphertext& ciphertext, const libff::alt_bn128_G2& decrypted );
 
     std::shared_ptr< std::vector< std::string > > toString();
 
+    std::shared_ptr< std::vector< uint8_t > > toBytes() const;
+
+    static std::shared_ptr< TEPublicKeyShare > fromBytes( const std::vector< uint8_t >& bytes,
+        size_t _signerIndex, size_t _requiredSigners, size_t _totalSigners );
+
     libff::alt_bn128_G2 getPublicKey() const;
 };
 
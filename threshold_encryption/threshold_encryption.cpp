@@ -29,13 +29,11 @@
 #include <tools/utils.h>
 
 #include <openssl/rand.h>
-#include <libff/common/profiling.hpp>
 
 namespace libBLS {
 
 TE::TE( const size_t t, const size_t n ) : t_( t ), n_( n ) {
-    libff::init_alt_bn128_params();
-    libff::inhibit_profiling_info = true;
+    ThresholdUtils::initCurve();
 }
 
 TE::~TE() {}
@@ -89,7 +87,7 @@ Ciphertext TE::getCiphertext(
     }
 
     libff::alt_bn128_G2 U, Y;
-    U = r * libff::alt_bn128_G2::one();
+    U = ThresholdUtils::mulGenerator( r );
     Y = r * common_public;
 
     std::string hash = Hash( Y );
@@ -266,15 +264,15 @@ std::vector< uint8_t > TE::CombineSharesIntoAESKey(
     }
 
     std::vector< libff::alt_bn128_Fr > lagrange_coeffs =
-        ThresholdUtils::LagrangeCoeffs( idx, this->t_ );
+        LagrangeCoeffsCache::getInstance().get( idx, this->t_ );
 
-    libff::alt_bn128_G2 sum = libff::alt_bn128_G2::zero();
+    std::vector< libff::alt_bn128_G2 > shares( this->t_ );
     for ( size_t i = 0; i < this->t_; ++i ) {
-        libff::alt_bn128_G2 temp = lagrange_coeffs[i] * decryptionShares[i].first;
-
-        sum = sum + temp;
+        shares[i] = decryptionShares[i].first;
     }
 
+    libff::alt_bn128_G2 sum = ThresholdUtils::MultiScalarMul( lagrange_coeffs, shares );
+
     std::string hash = this->Hash( sum );
 
     std::vector< uint8_t > ret( hash.size() );
@@ -0,0 +1,797 @@
+/*
+  Copyright (C) 2026- SKALE Labs
+
+  This file is part of libBLS.
+
+  libBLS is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Affero General Public License as published
+  by the Free Software Foundation, either version 3 of the License, or
+  (at your option) any later version.
+
+  libBLS is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Affero General Public License for more details.
+
+  You should have received a copy of the GNU Affero General Public License
+  along with libBLS.  If not, see <https://www.gnu.org/licenses/>.
+
+  @file bls_bench.cpp
+  @author SKALE Labs
+  @date 2026
+*/
+
+#include <bls/BLSPrivateKeyShare.h>
+#include <bls/BLSPublicKeyShare.h>
+#include <bls/BLSSigShare.h>
+#include <bls/BLSSigShareCombiner.h>
+#include <bls/BLSSigShareSet.h>
+#include <bls/bls.h>
+#include <dkg/DkgAccumulator.h>
+#include <dkg/dkg.h>
+#include <threshold_encryption/threshold_encryption.h>
+#include <tools/utils.h>
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <thread>
+
+#include <boost/program_options.hpp>
+#include <third_party/json.hpp>
+
+#define EXPAND_AS_STR( x ) __EXPAND_AS_STR__( x )
+#define __EXPAND_AS_STR__( x ) #x
+
+// runs op( thread_index, iteration ) iterations times on each of num_threads threads
+// and returns the number of calls per second over all threads
+double measure_throughput(
+    size_t num_threads, size_t iterations, const std::function< void( size_t, size_t ) >& op ) {
+    auto start = std::chrono::steady_clock::now();
+
+    std::vector< std::thread > threads;
+    for ( size_t t = 0; t < num_threads; ++t ) {
+        threads.emplace_back( [&op, t, iterations]() {
+            for ( size_t i = 0; i < iterations; ++i ) {
+                op( t, i );
+            }
+        } );
+    }
+    for ( auto& thread : threads ) {
+        thread.join();
+    }
+
+    std::chrono::duration< double > elapsed = std::chrono::steady_clock::now() - start;
+
+    return num_threads * iterations / elapsed.count();
+}
+
+// every printed measurement, written out with --json
+static nlohmann::json bench_results = nlohmann::json::array();
+
+// ( t, n ) pairs of the parameterized benchmarks
+static const std::vector< std::pair< size_t, size_t > > THRESHOLDS = {
+    { 11, 16 }, { 22, 32 }, { 86, 128 } };
+
+void print_throughput( const std::string& name, size_t num_threads, double ops_per_second,
+    const nlohmann::json& params = nlohmann::json::object() ) {
+    std::cout << name;
+    for ( const auto& param : params.items() ) {
+        std::cout << " " << param.key() << "=" << param.value();
+    }
+    std::cout << ": " << ops_per_second << " ops/s on " << num_threads << " thread(s), "
+              << ops_per_second / num_threads << " ops/s per core\n";
+
+    nlohmann::json result = { { "name", name }, { "params", params },
+        { "threads", num_threads }, { "ops_per_second", ops_per_second },
+        { "ops_per_second_per_core", ops_per_second / num_threads } };
+    bench_results.push_back( result );
+}
+
+void sign_bench( size_t num_threads, size_t iterations ) {
+    std::vector< libff::alt_bn128_Fr > secret_keys( num_threads );
+    std::vector< std::vector< libff::alt_bn128_G1 > > hashes( num_threads );
+    for ( size_t t = 0; t < num_threads; ++t ) {
+        secret_keys[t] = libff::alt_bn128_Fr::random_element();
+        for ( size_t i = 0; i < iterations; ++i ) {
+            hashes[t].push_back( libff::alt_bn128_G1::random_element() );
+        }
+    }
+
+    std::vector< libff::alt_bn128_G1 > signatures( num_threads );
+
+    double constant_time = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        signatures[t] = libBLS::Bls::Signing( hashes[t][i], secret_keys[t] );
+    } );
+    print_throughput( "Bls::Signing", num_threads, constant_time );
+
+    double variable_time = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        signatures[t] = secret_keys[t] * hashes[t][i];
+    } );
+    print_throughput( "variable time scalar multiplication", num_threads, variable_time );
+}
+
+void generator_bench( size_t num_threads, size_t iterations ) {
+    std::vector< std::vector< libff::alt_bn128_Fr > > secret_keys( num_threads );
+    for ( size_t t = 0; t < num_threads; ++t ) {
+        for ( size_t i = 0; i < iterations; ++i ) {
+            secret_keys[t].push_back( libff::alt_bn128_Fr::random_element() );
+        }
+    }
+
+    std::vector< libff::alt_bn128_G2 > public_keys( num_threads );
+
+    double fixed_base = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        public_keys[t] = libBLS::ThresholdUtils::mulGenerator( secret_keys[t][i] );
+    } );
+    print_throughput( "ThresholdUtils::mulGenerator", num_threads, fixed_base );
+
+    double variable_base = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        public_keys[t] = secret_keys[t][i] * libff::alt_bn128_G2::one();
+    } );
+    print_throughput( "G2 generator scalar multiplication", num_threads, variable_base );
+}
+
+// hashing to G1 as it was done before ThresholdUtils::HashtoG1WithCounter: Euler criterion
+// for every candidate, then a separate square root and mpz comparison of y and -y
+libff::alt_bn128_G1 euler_criterion_hash( std::shared_ptr< std::array< uint8_t, 32 > > hash ) {
+    libff::alt_bn128_Fq x1 = libBLS::ThresholdUtils::HashToFq( hash );
+
+    while ( true ) {
+        libff::alt_bn128_Fq y1_sqr = ( x1 ^ 3 ) + libff::alt_bn128_coeff_b;
+        libff::alt_bn128_Fq euler = y1_sqr ^ libff::alt_bn128_Fq::euler;
+
+        if ( euler == libff::alt_bn128_Fq::one() || euler == libff::alt_bn128_Fq::zero() ) {
+            libff::alt_bn128_Fq temp_y = y1_sqr.sqrt();
+
+            mpz_t pos_y;
+            mpz_init( pos_y );
+            temp_y.as_bigint().to_mpz( pos_y );
+
+            mpz_t neg_y;
+            mpz_init( neg_y );
+            ( -temp_y ).as_bigint().to_mpz( neg_y );
+
+            if ( mpz_cmp( pos_y, neg_y ) < 0 ) {
+                temp_y = -temp_y;
+            }
+
+            mpz_clear( pos_y );
+            mpz_clear( neg_y );
+
+            return libff::alt_bn128_G1( x1, temp_y, libff::alt_bn128_Fq::one() );
+        }
+
+        x1 = x1 + libff::alt_bn128_Fq::one();
+    }
+}
+
+void hash_bench( size_t num_threads, size_t iterations ) {
+    std::vector< std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > > hashes(
+        num_threads );
+    for ( size_t t = 0; t < num_threads; ++t ) {
+        for ( size_t i = 0; i < iterations; ++i ) {
+            auto hash = std::make_shared< std::array< uint8_t, 32 > >();
+            for ( auto& byte : *hash ) {
+                byte = static_cast< uint8_t >( std::rand() );
+            }
+            hashes[t].push_back( hash );
+        }
+    }
+
+    std::vector< libff::alt_bn128_G1 > points( num_threads );
+
+    double single_power = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        points[t] = libBLS::ThresholdUtils::HashtoG1WithCounter( hashes[t][i] ).first;
+    } );
+    print_throughput( "ThresholdUtils::HashtoG1WithCounter", num_threads, single_power );
+
+    double euler_criterion =
+        measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+            points[t] = euler_criterion_hash( hashes[t][i] );
+        } );
+    print_throughput( "Euler criterion and square root", num_threads, euler_criterion );
+}
+
+// signing and verification of a share through the shared_ptr API and through the value API
+void value_api_bench( size_t num_threads, size_t iterations ) {
+    auto skey = std::make_shared< BLSPrivateKeyShare >(
+        libff::alt_bn128_Fr::random_element(), num_threads, num_threads );
+    BLSPublicKeyShare pkey( *skey->getPrivateKey(), num_threads, num_threads );
+
+    std::vector< std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > > hashes(
+        num_threads );
+    for ( size_t t = 0; t < num_threads; ++t ) {
+        for ( size_t i = 0; i < 2 * iterations; ++i ) {
+            auto hash = std::make_shared< std::array< uint8_t, 32 > >();
+            for ( auto& byte : *hash ) {
+                byte = static_cast< uint8_t >( std::rand() );
+            }
+            hashes[t].push_back( hash );
+        }
+    }
+    pkey.getPublicKeyPrecomp();
+
+    std::vector< char > verified( num_threads );
+
+    // sign puts every hash into HashToG1Cache and VerifySig finds it there, so the shared_ptr
+    // numbers include one cache hit per operation, while the value API hashes twice
+    double shared_ptrs = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        auto sig_share = skey->sign( hashes[t][i], 1 );
+        verified[t] = pkey.VerifySig( hashes[t][i], sig_share, num_threads, num_threads );
+    } );
+    print_throughput( "sign and VerifySig with shared_ptr, verify hits the hash cache",
+        num_threads, shared_ptrs );
+
+    double values = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        const std::array< uint8_t, 32 >& hash = *hashes[t][iterations + i];
+        libBLS::SigWithHint sig_share = skey->sign( hash );
+        verified[t] = pkey.VerifySig( hash, sig_share.sig );
+    } );
+    print_throughput( "sign and VerifySig by value", num_threads, values );
+}
+
+// recombination of t shares with Lagrange coefficients as done in Bls::SignatureRecover
+void recover_bench( size_t num_threads, size_t iterations ) {
+    const size_t num_shares = 86;
+
+    std::vector< libff::alt_bn128_Fr > coeffs( num_shares );
+    std::vector< libff::alt_bn128_G1 > shares( num_shares );
+    for ( size_t i = 0; i < num_shares; ++i ) {
+        coeffs[i] = libff::alt_bn128_Fr::random_element();
+        shares[i] = libff::alt_bn128_G1::random_element();
+        shares[i].to_affine_coordinates();
+    }
+
+    std::vector< libff::alt_bn128_G1 > signatures( num_threads );
+
+    double pippenger = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        signatures[t] = libBLS::ThresholdUtils::MultiScalarMul( coeffs, shares );
+    } );
+    print_throughput( "ThresholdUtils::MultiScalarMul of 86 shares", num_threads, pippenger );
+
+    double naive = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        libff::alt_bn128_G1 sum = libff::alt_bn128_G1::zero();
+        for ( size_t i = 0; i < shares.size(); ++i ) {
+            sum = sum + coeffs[i] * shares[i];
+        }
+        signatures[t] = sum;
+    } );
+    print_throughput( "sum of 86 scalar multiplications", num_threads, naive );
+}
+
+// time from the arrival of the t-th share to the merged signature, averaged over iterations
+template < class SigShareSet >
+double measure_merge_latency( size_t iterations,
+    const std::vector< std::shared_ptr< BLSSigShare > >& sig_shares, size_t num_all ) {
+    std::chrono::duration< double > elapsed( 0 );
+
+    for ( size_t i = 0; i < iterations; ++i ) {
+        SigShareSet sig_set( sig_shares.size(), num_all );
+        for ( size_t j = 0; j + 1 < sig_shares.size(); ++j ) {
+            sig_set.addSigShare( sig_shares[j] );
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        sig_set.addSigShare( sig_shares.back() );
+        sig_set.merge();
+        elapsed += std::chrono::steady_clock::now() - start;
+    }
+
+    return elapsed.count() / iterations;
+}
+
+void merge_latency_bench( size_t iterations ) {
+    const size_t num_signed = 86;
+    const size_t num_all = 128;
+
+    auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >();
+    auto hash_with_hint = libBLS::Bls::HashtoG1withHint( hash_ptr );
+    std::string hint = libBLS::ThresholdUtils::fieldElementToString( hash_with_hint.first.Y ) +
+                       ":" + hash_with_hint.second;
+
+    std::vector< std::shared_ptr< BLSSigShare > > sig_shares;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        sig_shares.push_back( std::make_shared< BLSSigShare >(
+            std::make_shared< libff::alt_bn128_G1 >( libff::alt_bn128_G1::random_element() ),
+            hint, i + 1, num_signed, num_all ) );
+    }
+
+    double streaming = measure_merge_latency< BLSSigShareCombiner >(
+        iterations, sig_shares, num_all );
+    std::cout << "BLSSigShareCombiner: " << streaming * 1000
+              << " ms from the last of 86 shares to the signature\n";
+
+    double merge = measure_merge_latency< BLSSigShareSet >( iterations, sig_shares, num_all );
+    std::cout << "BLSSigShareSet::merge: " << merge * 1000
+              << " ms from the last of 86 shares to the signature\n";
+
+    nlohmann::json params = { { "t", num_signed }, { "n", num_all } };
+    bench_results.push_back( { { "name", "BLSSigShareCombiner last share latency" },
+        { "params", params }, { "latency_ms", streaming * 1000 } } );
+    bench_results.push_back( { { "name", "BLSSigShareSet::merge last share latency" },
+        { "params", params }, { "latency_ms", merge * 1000 } } );
+}
+
+void hash_with_hint_bench( size_t num_threads, size_t iterations ) {
+    std::vector< std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > > hashes(
+        num_threads );
+    for ( size_t t = 0; t < num_threads; ++t ) {
+        for ( size_t i = 0; i < iterations; ++i ) {
+            auto hash = std::make_shared< std::array< uint8_t, 32 > >();
+            for ( auto& byte : *hash ) {
+                byte = static_cast< uint8_t >( std::rand() );
+            }
+            hashes[t].push_back( hash );
+        }
+    }
+
+    std::vector< libff::alt_bn128_G1 > points( num_threads );
+
+    // distinct hashes, so every call misses the hash cache
+    double with_hint = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        points[t] = libBLS::Bls::HashtoG1withHint( hashes[t][i] ).first;
+    } );
+    print_throughput( "Bls::HashtoG1withHint", num_threads, with_hint );
+
+    // the same hash again and again, so every call hits the hash cache
+    double cached = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        points[t] = libBLS::ThresholdUtils::HashtoG1( hashes[t][0] );
+    } );
+    print_throughput( "ThresholdUtils::HashtoG1 cached", num_threads, cached );
+}
+
+// verification variants, merging and Lagrange coefficients for t of n signers
+void threshold_bench( size_t num_threads, size_t iterations, size_t num_signed, size_t num_all ) {
+    nlohmann::json params = { { "t", num_signed }, { "n", num_all } };
+
+    auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+    auto common_pkey = keys->second;
+    auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >();
+    for ( auto& byte : *hash_ptr ) {
+        byte = static_cast< uint8_t >( std::rand() );
+    }
+
+    auto pkeys = std::make_shared< std::map< size_t, std::shared_ptr< BLSPublicKeyShare > > >();
+    std::vector< std::shared_ptr< BLSSigShare > > sig_shares;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        ( *pkeys )[i + 1] = std::make_shared< BLSPublicKeyShare >(
+            *keys->first->at( i )->getPrivateKey(), num_signed, num_all );
+        ( *pkeys )[i + 1]->getPublicKeyPrecomp();
+        sig_shares.push_back( keys->first->at( i )->sign( hash_ptr, i + 1 ) );
+    }
+
+    BLSSigShareSet sig_set( num_signed, num_all );
+    for ( const auto& sig_share : sig_shares ) {
+        sig_set.addSigShare( sig_share );
+    }
+    std::shared_ptr< BLSSignature > common_sig = sig_set.merge();
+    common_pkey->getPublicKeyPrecomp();
+
+    std::vector< char > verified( num_threads );
+
+    double verify = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] = common_pkey->VerifySig( hash_ptr, common_sig );
+    } );
+    print_throughput( "BLSPublicKey::VerifySig", num_threads, verify, params );
+
+    double verify_with_helper =
+        measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+            verified[t] = common_pkey->VerifySigWithHelper( hash_ptr, common_sig );
+        } );
+    print_throughput(
+        "BLSPublicKey::VerifySigWithHelper", num_threads, verify_with_helper, params );
+
+    double verify_value = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] = common_pkey->VerifySig( *hash_ptr, *common_sig->getSig() );
+    } );
+    print_throughput( "BLSPublicKey::VerifySig by value", num_threads, verify_value, params );
+
+    double verify_share = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        size_t index = i % num_signed + 1;
+        verified[t] =
+            pkeys->at( index )->VerifySig( hash_ptr, sig_shares[index - 1], num_signed, num_all );
+    } );
+    print_throughput( "BLSPublicKeyShare::VerifySig", num_threads, verify_share, params );
+
+    // all t shares of one message at once, under their own public key shares
+    double verify_all = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] = sig_set.verifyAll( hash_ptr, pkeys ).empty();
+    } );
+    print_throughput( "BLSSigShareSet::verifyAll of t shares", num_threads, verify_all, params );
+
+    libff::alt_bn128_G1 hash_point = libBLS::ThresholdUtils::HashtoG1( hash_ptr );
+    std::vector< libff::alt_bn128_G1 > share_points;
+    std::vector< libff::alt_bn128_G2 > share_keys;
+    std::vector< std::tuple< std::shared_ptr< std::array< uint8_t, 32 > >, libff::alt_bn128_G1,
+        libff::alt_bn128_G2 > >
+        entries;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        share_points.push_back( *sig_shares[i]->getSigShare() );
+        share_keys.push_back( *pkeys->at( i + 1 )->getPublicKey() );
+    }
+
+    double same_hash = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] =
+            libBLS::Bls::BatchVerifySameHash( hash_point, share_points, share_keys ).empty();
+    } );
+    print_throughput( "Bls::BatchVerifySameHash of t signatures", num_threads, same_hash, params );
+
+    // t messages, each signed under its own key
+    auto signer = libBLS::Bls::KeyGeneration();
+    std::vector< std::shared_ptr< std::array< uint8_t, 32 > > > message_hashes;
+    std::vector< libff::alt_bn128_G1 > message_sigs;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        auto message_hash = std::make_shared< std::array< uint8_t, 32 > >();
+        for ( auto& byte : *message_hash ) {
+            byte = static_cast< uint8_t >( std::rand() );
+        }
+        message_hashes.push_back( message_hash );
+        message_sigs.push_back( signer.first * libBLS::ThresholdUtils::HashtoG1( *message_hash ) );
+
+        auto key = libBLS::Bls::KeyGeneration();
+        entries.emplace_back( message_hash,
+            key.first * libBLS::ThresholdUtils::HashtoG1( *message_hash ), key.second );
+    }
+
+    double batch_verify = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] = libBLS::Bls::BatchVerify( entries ).empty();
+    } );
+    print_throughput( "Bls::BatchVerify of t messages under t keys", num_threads, batch_verify,
+        params );
+
+    // t messages under one key
+    double aggregated = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] =
+            libBLS::Bls::AggregatedVerification( message_hashes, message_sigs, signer.second );
+    } );
+    print_throughput( "Bls::AggregatedVerification of t messages", num_threads, aggregated,
+        params );
+
+    std::vector< std::shared_ptr< BLSSignature > > signatures( num_threads );
+
+    double merge = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        BLSSigShareSet set( num_signed, num_all );
+        for ( const auto& sig_share : sig_shares ) {
+            set.addSigShare( sig_share );
+        }
+        signatures[t] = set.merge();
+    } );
+    print_throughput( "BLSSigShareSet::merge", num_threads, merge, params );
+
+    double merge_verified = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        BLSSigShareSet set( num_signed, num_all );
+        for ( const auto& sig_share : sig_shares ) {
+            set.addSigShare( sig_share );
+        }
+        signatures[t] = set.mergeVerified( hash_ptr, common_pkey, pkeys );
+    } );
+    print_throughput( "BLSSigShareSet::mergeVerified", num_threads, merge_verified, params );
+
+    std::vector< size_t > idx( num_signed );
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        idx[i] = i + 1;
+    }
+    std::vector< std::vector< libff::alt_bn128_Fr > > coeffs( num_threads );
+
+    double lagrange = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        coeffs[t] = libBLS::ThresholdUtils::LagrangeCoeffs( idx, num_signed );
+    } );
+    print_throughput( "ThresholdUtils::LagrangeCoeffs", num_threads, lagrange, params );
+
+    double lagrange_cached = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        coeffs[t] = libBLS::LagrangeCoeffsCache::getInstance().get( idx, num_signed );
+    } );
+    print_throughput( "LagrangeCoeffsCache::get", num_threads, lagrange_cached, params );
+}
+
+// the work of one participant in a DKG round for t of n
+void dkg_bench( size_t num_threads, size_t iterations, size_t num_signed, size_t num_all ) {
+    nlohmann::json params = { { "t", num_signed }, { "n", num_all } };
+
+    libBLS::Dkg dkg( num_signed, num_all );
+
+    std::vector< std::vector< libff::alt_bn128_Fr > > contributions( num_threads );
+    std::vector< std::vector< libff::alt_bn128_G2 > > verification_vectors( num_threads );
+
+    double contribution = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        std::vector< libff::alt_bn128_Fr > polynomial = dkg.GeneratePolynomial();
+        verification_vectors[t] = dkg.VerificationVector( polynomial );
+        contributions[t] = dkg.SecretKeyContribution( polynomial );
+    } );
+    print_throughput( "Dkg polynomial, verification vector and secret key contribution",
+        num_threads, contribution, params );
+
+    std::vector< char > verified( num_threads );
+
+    // a participant verifies n such shares per round
+    double verification = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        size_t index = i % num_all;
+        verified[t] =
+            dkg.Verification( index, contributions[t][index], verification_vectors[t] );
+    } );
+    print_throughput( "Dkg::Verification", num_threads, verification, params );
+
+    // the verification vector of a dealer is validated once and checked against every share
+    libBLS::VerificationVector commitments( verification_vectors[0] );
+
+    double cached_verification =
+        measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+            size_t index = i % num_all;
+            verified[t] = commitments.verify( index, contributions[0][index] );
+        } );
+    print_throughput( "Dkg::Verification with a validated VerificationVector", num_threads,
+        cached_verification, params );
+
+    // all n shares of a round at once, the same honest dealer stands in for every dealer
+    std::vector< libff::alt_bn128_Fr > round_shares( num_all, contributions[0][0] );
+    std::vector< std::vector< libff::alt_bn128_G2 > > round_vectors(
+        num_all, verification_vectors[0] );
+
+    double verify_all = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] = dkg.VerifyAll( 0, round_shares, round_vectors ).empty();
+    } );
+    print_throughput( "Dkg::VerifyAll of n dealers", num_threads, verify_all, params );
+
+    // public key shares of all nodes from the verification vectors of all dealers
+    std::vector< std::pair< libff::alt_bn128_G2, std::vector< libff::alt_bn128_G2 > > >
+        public_keys( num_threads );
+
+    double public_key_shares = measure_throughput( num_threads, iterations,
+        [&]( size_t t, size_t ) { public_keys[t] = dkg.PublicKeyShares( round_vectors ); } );
+    print_throughput( "Dkg::PublicKeyShares", num_threads, public_key_shares, params );
+
+    // dealers verified and summed one by one as their messages arrive
+    std::vector< std::shared_ptr< libBLS::DkgAccumulator > > accumulators( num_threads );
+
+    double accumulate = measure_throughput( num_threads, iterations, [&]( size_t t, size_t i ) {
+        if ( i % num_all == 0 ) {
+            accumulators[t] = std::make_shared< libBLS::DkgAccumulator >( 0, num_signed, num_all );
+        }
+        verified[t] =
+            accumulators[t]->addDealer( i % num_all, round_shares[0], verification_vectors[0] );
+    } );
+    print_throughput( "DkgAccumulator::addDealer", num_threads, accumulate, params );
+
+    std::vector< libff::alt_bn128_Fr > secret_keys( num_threads );
+
+    double share_create = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        secret_keys[t] = dkg.SecretKeyShareCreate( contributions[t] );
+    } );
+    print_throughput( "Dkg::SecretKeyShareCreate", num_threads, share_create, params );
+}
+
+// one dealer of a key ceremony: the shares for all n nodes and the verification vector,
+// ( t, n ) grows up to ( 683, 1024 ) with t = 2n / 3 + 1
+void key_ceremony_bench( size_t num_threads, size_t iterations ) {
+    for ( size_t num_all : { 16, 128, 1024 } ) {
+        size_t num_signed = 2 * num_all / 3 + 1;
+        nlohmann::json params = { { "t", num_signed }, { "n", num_all } };
+
+        libBLS::Dkg dkg( num_signed, num_all );
+        std::vector< libff::alt_bn128_Fr > polynomial = dkg.GeneratePolynomial();
+
+        std::vector< std::vector< libff::alt_bn128_Fr > > contributions( num_threads );
+
+        double contribution = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+            contributions[t] = dkg.SecretKeyContribution( polynomial );
+        } );
+        print_throughput( "Dkg::SecretKeyContribution", num_threads, contribution, params );
+
+        std::vector< std::vector< libff::alt_bn128_G2 > > verification_vectors( num_threads );
+
+        double verification_vector =
+            measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+                verification_vectors[t] = dkg.VerificationVector( polynomial );
+            } );
+        print_throughput( "Dkg::VerificationVector", num_threads, verification_vector, params );
+    }
+}
+
+// threshold encryption of a message and its decryption with t of n shares
+void te_bench( size_t num_threads, size_t iterations, size_t num_signed, size_t num_all ) {
+    nlohmann::json params = { { "t", num_signed }, { "n", num_all } };
+
+    libBLS::Dkg dkg( num_signed, num_all );
+    std::vector< libff::alt_bn128_Fr > polynomial = dkg.GeneratePolynomial();
+    std::vector< libff::alt_bn128_Fr > secret_keys = dkg.SecretKeyContribution( polynomial );
+    libff::alt_bn128_G2 common_public = libBLS::ThresholdUtils::mulGenerator( polynomial[0] );
+    libff::alt_bn128_G2 public_key = libBLS::ThresholdUtils::mulGenerator( secret_keys[0] );
+
+    libBLS::TE te( num_signed, num_all );
+    std::string message( 64, 'a' );
+
+    std::vector< libBLS::Ciphertext > ciphertexts( num_threads );
+
+    double encrypt = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        ciphertexts[t] = libBLS::TE::getCiphertext( message, common_public );
+    } );
+    print_throughput( "TE::getCiphertext", num_threads, encrypt, params );
+
+    std::vector< libff::alt_bn128_G2 > decryption_shares( num_threads );
+
+    double decrypt = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        decryption_shares[t] = libBLS::TE::getDecryptionShare( ciphertexts[t], secret_keys[0] );
+    } );
+    print_throughput( "TE::getDecryptionShare", num_threads, decrypt, params );
+
+    std::vector< char > verified( num_threads );
+
+    double verify = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        verified[t] = libBLS::TE::Verify( ciphertexts[t], decryption_shares[t], public_key );
+    } );
+    print_throughput( "TE::Verify", num_threads, verify, params );
+
+    libBLS::Ciphertext ciphertext = libBLS::TE::getCiphertext( message, common_public );
+    std::vector< std::pair< libff::alt_bn128_G2, size_t > > shares;
+    for ( size_t i = 0; i < num_signed; ++i ) {
+        shares.emplace_back( libBLS::TE::getDecryptionShare( ciphertext, secret_keys[i] ), i + 1 );
+    }
+
+    std::vector< std::string > plaintexts( num_threads );
+
+    double combine = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        plaintexts[t] = te.CombineShares( ciphertext, shares );
+    } );
+    print_throughput( "TE::CombineShares", num_threads, combine, params );
+}
+
+// verification of one signature on 1, 2, 4, ... threads up to max_threads, the throughput
+// should grow with the number of threads as long as there are free cores
+void verify_scaling_bench( size_t max_threads, size_t iterations ) {
+    auto keys = BLSPrivateKeyShare::generateSampleKeys( 1, 1 );
+    auto common_pkey = keys->second;
+    auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >();
+    for ( auto& byte : *hash_ptr ) {
+        byte = static_cast< uint8_t >( std::rand() );
+    }
+
+    BLSSigShareSet sig_set( 1, 1 );
+    sig_set.addSigShare( keys->first->at( 0 )->sign( hash_ptr, 1 ) );
+    std::shared_ptr< BLSSignature > common_sig = sig_set.merge();
+    common_pkey->getPublicKeyPrecomp();
+
+    std::vector< size_t > thread_counts;
+    for ( size_t num_threads = 1; num_threads < max_threads; num_threads *= 2 ) {
+        thread_counts.push_back( num_threads );
+    }
+    thread_counts.push_back( max_threads );
+
+    double single_thread = 0;
+    for ( size_t num_threads : thread_counts ) {
+        std::vector< char > verified( num_threads );
+
+        double verify = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+            verified[t] = common_pkey->VerifySig( hash_ptr, common_sig );
+        } );
+        if ( num_threads == 1 ) {
+            single_thread = verify;
+        }
+        print_throughput( "BLSPublicKey::VerifySig scaling", num_threads, verify );
+        std::cout << "    " << 100 * verify / ( single_thread * num_threads )
+                  << "% of linear scaling\n";
+    }
+}
+
+// string and binary serialization round trips
+void serialization_bench( size_t num_threads, size_t iterations ) {
+    const size_t num_signed = 11;
+    const size_t num_all = 16;
+
+    auto keys = BLSPrivateKeyShare::generateSampleKeys( num_signed, num_all );
+    auto hash_ptr = std::make_shared< std::array< uint8_t, 32 > >();
+    auto sig_share = keys->first->at( 0 )->sign( hash_ptr, 1 );
+    auto pkey = keys->second;
+
+    std::vector< std::shared_ptr< BLSSigShare > > sig_shares( num_threads );
+
+    double sig_share_string = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        sig_shares[t] =
+            std::make_shared< BLSSigShare >( sig_share->toString(), 1, num_signed, num_all );
+    } );
+    print_throughput( "BLSSigShare toString round trip", num_threads, sig_share_string );
+
+    double sig_share_bytes = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        sig_shares[t] = BLSSigShare::fromBytes( *sig_share->toBytes(), 1, num_signed, num_all );
+    } );
+    print_throughput( "BLSSigShare toBytes round trip", num_threads, sig_share_bytes );
+
+    std::vector< std::shared_ptr< BLSPublicKey > > pkeys( num_threads );
+
+    double pkey_string = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        pkeys[t] = std::make_shared< BLSPublicKey >( pkey->toString() );
+    } );
+    print_throughput( "BLSPublicKey toString round trip", num_threads, pkey_string );
+
+    double pkey_bytes = measure_throughput( num_threads, iterations, [&]( size_t t, size_t ) {
+        pkeys[t] = BLSPublicKey::fromBytes( *pkey->toBytes() );
+    } );
+    print_throughput( "BLSPublicKey toBytes round trip", num_threads, pkey_bytes );
+}
+
+int main( int argc, const char* argv[] ) {
+    int r = 1;
+    try {
+        boost::program_options::options_description desc( "Options" );
+        desc.add_options()( "help", "Show this help screen" )( "version", "Show version number" )(
+            "threads", boost::program_options::value< size_t >(),
+            "Number of threads (optional, all cores by default)" )( "iterations",
+            boost::program_options::value< size_t >()->default_value( 1000 ),
+            "Number of operations per thread" )( "json",
+            boost::program_options::value< std::string >(),
+            "Write results to a JSON file (optional)" );
+
+        boost::program_options::variables_map vm;
+        boost::program_options::store(
+            boost::program_options::parse_command_line( argc, argv, desc ), vm );
+        boost::program_options::notify( vm );
+
+        if ( vm.count( "help" ) ) {
+            std::cout << "BLS benchmark tool, version " << EXPAND_AS_STR( BLS_VERSION ) << '\n'
+                      << "Usage:\n"
+                      << "   " << argv[0]
+                      << " [--threads <num_threads>] [--iterations <num>] [--json <file>]"
+                      << '\n'
+                      << desc << '\n';
+            return 0;
+        }
+        if ( vm.count( "version" ) ) {
+            std::cout << EXPAND_AS_STR( BLS_VERSION ) << '\n';
+            return 0;
+        }
+
+        size_t num_threads = std::max( std::thread::hardware_concurrency(), 1u );
+        if ( vm.count( "threads" ) ) {
+            num_threads = vm["threads"].as< size_t >();
+        }
+        size_t iterations = vm["iterations"].as< size_t >();
+
+        if ( num_threads == 0 || iterations == 0 ) {
+            throw std::runtime_error( "--threads and --iterations should be positive" );
+        }
+
+        libBLS::ThresholdUtils::initCurve();
+
+        sign_bench( num_threads, iterations );
+        generator_bench( num_threads, iterations );
+        hash_bench( num_threads, iterations );
+        hash_with_hint_bench( num_threads, iterations );
+        value_api_bench( num_threads, std::max( iterations / 10, size_t( 1 ) ) );
+        recover_bench( num_threads, std::max( iterations / 100, size_t( 1 ) ) );
+        merge_latency_bench( std::max( iterations / 100, size_t( 1 ) ) );
+        for ( const auto& threshold : THRESHOLDS ) {
+            size_t heavy_iterations = std::max( iterations / 100, size_t( 1 ) );
+            threshold_bench( num_threads, heavy_iterations, threshold.first, threshold.second );
+            dkg_bench( num_threads, heavy_iterations, threshold.first, threshold.second );
+            te_bench( num_threads, heavy_iterations, threshold.first, threshold.second );
+        }
+        key_ceremony_bench( num_threads, std::max( iterations / 100, size_t( 1 ) ) );
+        serialization_bench( num_threads, iterations );
+        verify_scaling_bench( num_threads, std::max( iterations / 10, size_t( 1 ) ) );
+
+        if ( vm.count( "json" ) ) {
+            nlohmann::json report = { { "version", EXPAND_AS_STR( BLS_VERSION ) },
+                { "threads", num_threads }, { "iterations", iterations },
+                { "results", bench_results } };
+
+            std::ofstream out( vm["json"].as< std::string >() );
+            if ( !out ) {
+                throw std::runtime_error(
+                    "Can not open " + vm["json"].as< std::string >() + " for writing" );
+            }
+            out << report.dump( 4 ) << '\n';
+        }
+        r = 0;  // success
+    } catch ( std::exception& ex ) {
+        r = 1;
+        std::string str_what = ex.what();
+        if ( str_what.empty() )
+            str_what = "exception without description";
+        std::cerr << "exception: " << str_what << "\n";
+    } catch ( ... ) {
+        r = 2;
+        std::cerr << "unknown exception\n";
+    }
+    return r;
+}
@@ -103,25 +103,29 @@ void GenerateSecretKeys( const size_t t, const size_t n, const std::vector< std:
         }
     }
 
+    // every verification vector is validated once and then only evaluated for each node
+    std::vector< libBLS::VerificationVector > commitments;
+    for ( size_t j = 0; j < n; ++j ) {
+        commitments.emplace_back( verification_vector[j] );
+    }
+
     std::vector< libff::alt_bn128_Fr > secret_key( n, libff::alt_bn128_Fr::zero() );
     for ( size_t i = 0; i < n; ++i ) {
         for ( size_t j = 0; j < n; ++j ) {
-            if ( !dkg_instance.Verification(
-                     i, secret_key_contribution[i][j], verification_vector[j] ) ) {
+            if ( !dkg_instance.Verification( i, secret_key_contribution[i][j], commitments[j] ) ) {
                 throw std::runtime_error( std::to_string( j ) + "-th node was not verified by " +
                                           std::to_string( i ) + "-th node" );
             }
         }
     }
 
-    std::vector< libff::alt_bn128_G2 > public_keys( n );
-    libff::alt_bn128_G2 common_public_key = libff::alt_bn128_G2::zero();
     for ( size_t i = 0; i < n; ++i ) {
         secret_key[i] = dkg_instance.SecretKeyShareCreate( secret_key_contribution[i] );
-        public_keys[i] = verification_vector[i][0];
-        common_public_key = common_public_key + public_keys[i];
     }
 
+    auto public_keys = dkg_instance.PublicKeyShares( verification_vector );
+    libff::alt_bn128_G2 common_public_key = public_keys.first;
+
     for ( size_t i = 0; i < n; ++i ) {
         nlohmann::json BLS_key_file;
 
@@ -131,7 +135,7 @@ void GenerateSecretKeys( const size_t t, const size_t n, const std::vector< std:
         std::string str_file_name = "BLS_keys" + std::to_string( i ) + ".json";
         std::ofstream out( str_file_name.c_str() );
 
-        libff::alt_bn128_G2 publ_key = dkg_instance.GetPublicKeyFromSecretKey( secret_key[i] );
+        libff::alt_bn128_G2 publ_key = public_keys.second[i];
         publ_key.to_affine_coordinates();
         BLS_key_file["BLSPublicKey0"] =
             libBLS::ThresholdUtils::fieldElementToString( publ_key.X.c0 );
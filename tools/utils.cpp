@@ -29,20 +29,53 @@
 
 #include <tools/utils.h>
 
+#include <libff/common/profiling.hpp>
+
 
 namespace libBLS {
 
 
 std::atomic< bool > ThresholdUtils::is_initialized = false;
 
-std::mutex initMutex;
+LibBLSContext::LibBLSContext() {
+    libff::init_alt_bn128_params();
+
+    // libff profiling keeps global maps that are not synchronized, verification runs on many
+    // threads at once
+    libff::inhibit_profiling_info = true;
+    libff::inhibit_profiling_counters = true;
+
+    // initialize openssl ciphers
+    OpenSSL_add_all_ciphers();
+
+    // initialize random number generator (for IVs)
+    RAND_load_file( "/dev/urandom", 32 );
+
+    g2GeneratorPrecomp = libff::alt_bn128_ate_precompute_G2( libff::alt_bn128_G2::one() );
+
+    sqrtPower = libff::alt_bn128_modulus_q;
+    mpn_add_1( sqrtPower.data, sqrtPower.data, libff::alt_bn128_q_limbs, 1 );
+    mpn_rshift( sqrtPower.data, sqrtPower.data, libff::alt_bn128_q_limbs, 2 );
+
+    ThresholdUtils::is_initialized = true;
+}
+
+const LibBLSContext& LibBLSContext::get() {
+    // initialization of a local static is thread safe and is only checked afterwards
+    static const LibBLSContext context;
+    return context;
+}
+
+const libff::alt_bn128_ate_G2_precomp& LibBLSContext::getG2GeneratorPrecomp() const {
+    return g2GeneratorPrecomp;
+}
+
+const libff::bigint< libff::alt_bn128_q_limbs >& LibBLSContext::getSqrtPower() const {
+    return sqrtPower;
+}
 
 void ThresholdUtils::initCurve() {
-    std::lock_guard< std::mutex > lock( initMutex );
-    if ( !is_initialized ) {
-        libff::init_alt_bn128_params();
-        is_initialized = true;
-    }
+    LibBLSContext::get();
 }
 
 void ThresholdUtils::checkSigners( size_t _requiredSigners, size_t _totalSigners ) {
@@ -59,6 +92,563 @@ void ThresholdUtils::checkSigners( size_t _requiredSigners, size_t _totalSigners
     }
 }
 
+// psi( P ) == [6 * x^2] * P holds exactly for the points of G2 on the BN254 twist (see
+// El Housni, Guillevic, Piellard "Co-factor clearing and subgroup membership testing on
+// pairing-friendly curves"), a 127 bit multiplication instead of a 254 bit one by the order
+template <>
+bool ThresholdUtils::ValidateKey( const libff::alt_bn128_G2& point ) {
+    static const libff::bigint< 2 > six_x_squared( "147946756881789318990833708069417712966" );
+
+    return point.is_well_formed() && point.mul_by_q() == six_x_squared * point;
+}
+
+const libff::alt_bn128_ate_G2_precomp& ThresholdUtils::G2GeneratorPrecomp() {
+    return LibBLSContext::get().getG2GeneratorPrecomp();
+}
+
+bool ThresholdUtils::CheckPairing( const libff::alt_bn128_G1& signature,
+    const libff::alt_bn128_G1& hash, const libff::alt_bn128_G2& public_key ) {
+    if ( public_key.is_zero() ) {
+        return false;
+    }
+
+    return CheckPairing( signature, hash, libff::alt_bn128_ate_precompute_G2( public_key ) );
+}
+
+bool ThresholdUtils::CheckPairing( const libff::alt_bn128_G1& signature,
+    const libff::alt_bn128_G1& hash, const libff::alt_bn128_ate_G2_precomp& public_key_precomp ) {
+    if ( signature.is_zero() || hash.is_zero() ) {
+        return false;
+    }
+
+    // e(signature, g2) == e(hash, public_key) <=> e(-signature, g2) * e(hash, public_key) == 1,
+    // so both pairings share one Miller loop and one final exponentiation
+    libff::alt_bn128_Fq12 miller_loop =
+        libff::alt_bn128_ate_double_miller_loop( libff::alt_bn128_ate_precompute_G1( -signature ),
+            G2GeneratorPrecomp(), libff::alt_bn128_ate_precompute_G1( hash ), public_key_precomp );
+
+    return libff::alt_bn128_final_exponentiation( miller_loop ) == libff::alt_bn128_GT::one();
+}
+
+libff::alt_bn128_Fq12 ThresholdUtils::MultiMillerLoop(
+    const std::vector< libff::alt_bn128_G1 >& points,
+    const std::vector< const libff::alt_bn128_ate_G2_precomp* >& precomps ) {
+    if ( points.size() != precomps.size() ) {
+        throw IncorrectInput( "Number of G1 points and G2 precomputations do not match" );
+    }
+
+    // e(0, Q) == 1, and libff Miller loop does not handle zero points
+    std::vector< libff::alt_bn128_ate_G1_precomp > g1_precomps;
+    std::vector< const libff::alt_bn128_ate_G2_precomp* > g2_precomps;
+    for ( size_t i = 0; i < points.size(); ++i ) {
+        if ( !precomps[i] ) {
+            throw IncorrectInput( "G2 precomputation is null" );
+        }
+        if ( !points[i].is_zero() ) {
+            g1_precomps.push_back( libff::alt_bn128_ate_precompute_G1( points[i] ) );
+            g2_precomps.push_back( precomps[i] );
+        }
+    }
+
+    auto add_line = []( const libff::alt_bn128_Fq12& f, const libff::alt_bn128_ate_G1_precomp& P,
+                        const libff::alt_bn128_ate_ell_coeffs& c ) {
+        return f.mul_by_024( c.ell_0, P.PY * c.ell_VW, P.PX * c.ell_VV );
+    };
+
+    // same steps as libff alt_bn128_ate_miller_loop, but one squaring per step is shared by
+    // all the pairs of a chunk, chunks run on separate threads
+    std::mutex result_mutex;
+    libff::alt_bn128_Fq12 loop_product = libff::alt_bn128_Fq12::one();
+    libff::alt_bn128_Fq12 lines_product = libff::alt_bn128_Fq12::one();
+
+    ParallelFor( g1_precomps.size(), [&]( size_t begin, size_t end ) {
+        libff::alt_bn128_Fq12 f = libff::alt_bn128_Fq12::one();
+        const auto& loop_count = libff::alt_bn128_ate_loop_count;
+        bool found_one = false;
+        size_t idx = 0;
+
+        for ( long i = loop_count.max_bits(); i >= 0; --i ) {
+            const bool bit = loop_count.test_bit( i );
+            if ( !found_one ) {
+                found_one = bit;
+                continue;
+            }
+
+            f = f.squared();
+            for ( size_t j = begin; j < end; ++j ) {
+                f = add_line( f, g1_precomps[j], g2_precomps[j]->coeffs[idx] );
+            }
+            ++idx;
+
+            if ( bit ) {
+                for ( size_t j = begin; j < end; ++j ) {
+                    f = add_line( f, g1_precomps[j], g2_precomps[j]->coeffs[idx] );
+                }
+                ++idx;
+            }
+        }
+
+        libff::alt_bn128_Fq12 lines = libff::alt_bn128_Fq12::one();
+        for ( size_t j = begin; j < end; ++j ) {
+            lines = add_line( lines, g1_precomps[j], g2_precomps[j]->coeffs[idx] );
+            lines = add_line( lines, g1_precomps[j], g2_precomps[j]->coeffs[idx + 1] );
+        }
+
+        std::lock_guard< std::mutex > lock( result_mutex );
+        loop_product = loop_product * f;
+        lines_product = lines_product * lines;
+    } );
+
+    if ( libff::alt_bn128_ate_is_loop_count_neg ) {
+        loop_product = loop_product.inverse();
+    }
+
+    return loop_product * lines_product;
+}
+
+std::vector< libff::bigint< BATCH_WEIGHT_LIMBS > > ThresholdUtils::GenerateBatchWeights(
+    size_t count ) {
+    std::vector< libff::bigint< BATCH_WEIGHT_LIMBS > > weights( count );
+
+    for ( auto& weight : weights ) {
+        do {
+            if ( RAND_bytes( reinterpret_cast< unsigned char* >( weight.data ),
+                     sizeof( weight.data ) ) != 1 ) {
+                throw std::runtime_error( "Failed to generate random weights" );
+            }
+        } while ( weight.is_zero() );
+    }
+
+    return weights;
+}
+
+namespace {
+
+// window width of the constant time multiplication, the table keeps 2^( w - 1 ) odd multiples
+constexpr size_t CT_WINDOW = 5;
+constexpr size_t CT_TABLE_SIZE = size_t( 1 ) << ( CT_WINDOW - 1 );
+constexpr size_t CT_DIGITS = ( libff::alt_bn128_r_bitcount + CT_WINDOW - 1 ) / CT_WINDOW;
+
+// dst = flag ? src : dst for flag equal to 0 or 1 without branching on flag
+template < mp_size_t N >
+void ConditionalCopy( libff::bigint< N >& dst, const libff::bigint< N >& src, mp_limb_t flag ) {
+    mp_limb_t mask = mp_limb_t( 0 ) - flag;
+    for ( mp_size_t i = 0; i < N; ++i ) {
+        dst.data[i] ^= mask & ( dst.data[i] ^ src.data[i] );
+    }
+}
+
+void ConditionalCopy( libff::alt_bn128_Fq& dst, const libff::alt_bn128_Fq& src, mp_limb_t flag ) {
+    ConditionalCopy( dst.mont_repr, src.mont_repr, flag );
+}
+
+void ConditionalCopy( libff::alt_bn128_Fq2& dst, const libff::alt_bn128_Fq2& src, mp_limb_t flag ) {
+    ConditionalCopy( dst.c0, src.c0, flag );
+    ConditionalCopy( dst.c1, src.c1, flag );
+}
+
+template < class Point >
+void ConditionalCopy( Point& dst, const Point& src, mp_limb_t flag ) {
+    ConditionalCopy( dst.X, src.X, flag );
+    ConditionalCopy( dst.Y, src.Y, flag );
+    ConditionalCopy( dst.Z, src.Z, flag );
+}
+
+mp_limb_t IsEqual( uint64_t lhs, uint64_t rhs ) {
+    uint64_t diff = lhs ^ rhs;
+    return mp_limb_t( 1 ^ ( ( diff | ( uint64_t( 0 ) - diff ) ) >> 63 ) );
+}
+
+// k * P == sum( d_i * 2^( w * i ) * P ) where every d_i is odd and nonzero, so the sequence of
+// operations does not depend on k
+struct SignedDigits {
+    std::array< uint64_t, CT_DIGITS > indexes;  // ( |d_i| - 1 ) / 2
+    std::array< mp_limb_t, CT_DIGITS > negative;
+    mp_limb_t negate_result;
+};
+
+SignedDigits RecodeScalar( const libff::alt_bn128_Fr& scalar ) {
+    SignedDigits digits;
+
+    libff::bigint< libff::alt_bn128_r_limbs > k = scalar.as_bigint();
+
+    // the recoding needs an odd scalar, so even k is replaced by r - k,
+    // ( r - k ) * P == -k * P and the result is negated back in the end
+    libff::bigint< libff::alt_bn128_r_limbs > negated_k;
+    mpn_sub_n( negated_k.data, libff::alt_bn128_modulus_r.data, k.data, libff::alt_bn128_r_limbs );
+    digits.negate_result = 1 ^ ( k.data[0] & 1 );
+    ConditionalCopy( k, negated_k, digits.negate_result );
+
+    // d_i = ( k mod 2^( w + 1 ) ) - 2^w, k = ( k >> w ) | 1
+    for ( size_t i = 0; i + 1 < CT_DIGITS; ++i ) {
+        int64_t digit = int64_t( k.data[0] & ( ( mp_limb_t( 1 ) << ( CT_WINDOW + 1 ) ) - 1 ) ) -
+                        ( int64_t( 1 ) << CT_WINDOW );
+        uint64_t sign = uint64_t( digit ) >> 63;
+
+        digits.indexes[i] = ( ( uint64_t( digit ) ^ ( uint64_t( 0 ) - sign ) ) + sign ) >> 1;
+        digits.negative[i] = mp_limb_t( sign );
+
+        mpn_rshift( k.data, k.data, libff::alt_bn128_r_limbs, CT_WINDOW );
+        k.data[0] |= 1;
+    }
+    digits.indexes[CT_DIGITS - 1] = k.data[0] >> 1;
+    digits.negative[CT_DIGITS - 1] = 0;
+
+    return digits;
+}
+
+// reads every entry of the table, so the memory access pattern does not depend on the digit
+template < class Point >
+Point Lookup( const std::array< Point, CT_TABLE_SIZE >& table, const SignedDigits& digits,
+    size_t i ) {
+    Point entry = table[0];
+    for ( size_t j = 1; j < CT_TABLE_SIZE; ++j ) {
+        ConditionalCopy( entry, table[j], IsEqual( j, digits.indexes[i] ) );
+    }
+    ConditionalCopy( entry, -entry, digits.negative[i] );
+    return entry;
+}
+
+// table[j] = ( 2 * j + 1 ) * point
+template < class Point >
+std::array< Point, CT_TABLE_SIZE > OddMultiples( const Point& point ) {
+    std::array< Point, CT_TABLE_SIZE > table;
+    Point doubled = point.dbl();
+    table[0] = point;
+    for ( size_t j = 1; j < CT_TABLE_SIZE; ++j ) {
+        table[j] = table[j - 1] + doubled;
+    }
+    return table;
+}
+
+// q = 3 mod 4, so y = a^( ( q + 1 ) / 4 ) is a square root of a whenever a is a square,
+// and y^2 == a tells whether it is
+bool Sqrt( const libff::alt_bn128_Fq& a, libff::alt_bn128_Fq& root ) {
+    root = a ^ LibBLSContext::get().getSqrtPower();
+    return root.squared() == a;
+}
+
+// Fq2 = Fq[u] / ( u^2 + 1 ), ( x0 + x1 * u )^2 == a0 + a1 * u for x0^2 = ( a0 +- |a| ) / 2
+// and x1 = a1 / ( 2 * x0 ), where |a|^2 = a0^2 + a1^2 is the norm of a
+bool Sqrt( const libff::alt_bn128_Fq2& a, libff::alt_bn128_Fq2& root ) {
+    if ( a.c1.is_zero() ) {
+        if ( Sqrt( a.c0, root.c0 ) ) {
+            root.c1 = libff::alt_bn128_Fq::zero();
+            return true;
+        }
+        root.c0 = libff::alt_bn128_Fq::zero();
+        return Sqrt( -a.c0, root.c1 );
+    }
+
+    libff::alt_bn128_Fq norm;
+    if ( !Sqrt( a.c0.squared() + a.c1.squared(), norm ) ) {
+        return false;
+    }
+
+    libff::alt_bn128_Fq half = libff::alt_bn128_Fq( 2 ).inverse();
+    if ( !Sqrt( ( a.c0 + norm ) * half, root.c0 ) && !Sqrt( ( a.c0 - norm ) * half, root.c0 ) ) {
+        return false;
+    }
+    root.c1 = a.c1 * ( root.c0 + root.c0 ).inverse();
+
+    return root.squared() == a;
+}
+
+// y is the smaller one of y and -y as an integer
+bool IsLowerRoot( const libff::alt_bn128_Fq& y ) {
+    libff::bigint< libff::alt_bn128_q_limbs > pos_y = y.as_bigint();
+    libff::bigint< libff::alt_bn128_q_limbs > neg_y = ( -y ).as_bigint();
+    return mpn_cmp( pos_y.data, neg_y.data, libff::alt_bn128_q_limbs ) < 0;
+}
+
+bool IsLowerRoot( const libff::alt_bn128_Fq2& y ) {
+    return y.c1.is_zero() ? IsLowerRoot( y.c0 ) : IsLowerRoot( y.c1 );
+}
+
+constexpr uint8_t INFINITY_FLAG = 0x80;
+constexpr uint8_t LARGER_ROOT_FLAG = 0x40;
+
+// limbs are 64 bit on native builds and 32 bit with emscripten, the byte order of the
+// encoding does not depend on it
+constexpr size_t LIMB_BYTES = GMP_NUMB_BITS / 8;
+
+// i-th least significant byte of value
+template < mp_size_t N >
+uint8_t BigintByte( const libff::bigint< N >& value, size_t i ) {
+    return uint8_t( value.data[i / LIMB_BYTES] >> ( 8 * ( i % LIMB_BYTES ) ) );
+}
+
+template < mp_size_t N >
+void BigintToBytes( const libff::bigint< N >& value, uint8_t* bytes ) {
+    for ( size_t i = 0; i < 32; ++i ) {
+        bytes[31 - i] = BigintByte( value, i );
+    }
+}
+
+template < mp_size_t N >
+libff::bigint< N > BigintFromBytes( const uint8_t* bytes, const libff::bigint< N >& modulus ) {
+    libff::bigint< N > value;
+    for ( size_t i = 0; i < 32; ++i ) {
+        value.data[i / LIMB_BYTES] |= mp_limb_t( bytes[31 - i] ) << ( 8 * ( i % LIMB_BYTES ) );
+    }
+
+    if ( mpn_cmp( value.data, modulus.data, N ) >= 0 ) {
+        throw ThresholdUtils::IncorrectInput( "Field element is not reduced" );
+    }
+
+    return value;
+}
+
+}  // namespace
+
+libff::alt_bn128_G1 ThresholdUtils::ConstantTimeMul(
+    const libff::alt_bn128_Fr& scalar, const libff::alt_bn128_G1& point ) {
+    if ( point.is_zero() ) {
+        return point;
+    }
+
+    SignedDigits digits = RecodeScalar( scalar );
+    auto table = OddMultiples( point );
+
+    libff::alt_bn128_G1 result = Lookup( table, digits, CT_DIGITS - 1 );
+    for ( size_t i = CT_DIGITS - 1; i-- > 0; ) {
+        for ( size_t j = 0; j < CT_WINDOW; ++j ) {
+            result = result.dbl();
+        }
+        result = result + Lookup( table, digits, i );
+    }
+
+    ConditionalCopy( result, -result, digits.negate_result );
+
+    return result;
+}
+
+libff::alt_bn128_G2 ThresholdUtils::mulGenerator( const libff::alt_bn128_Fr& scalar ) {
+    // tables[i] keeps odd multiples of 2^( w * i ) * G2, so the product takes one addition
+    // per digit and no doublings
+    static const std::vector< std::array< libff::alt_bn128_G2, CT_TABLE_SIZE > > tables = []() {
+        initCurve();
+
+        std::vector< std::array< libff::alt_bn128_G2, CT_TABLE_SIZE > > result;
+        result.reserve( CT_DIGITS );
+
+        libff::alt_bn128_G2 base = libff::alt_bn128_G2::one();
+        for ( size_t i = 0; i < CT_DIGITS; ++i ) {
+            result.push_back( OddMultiples( base ) );
+            for ( size_t j = 0; j < CT_WINDOW; ++j ) {
+                base = base.dbl();
+            }
+        }
+
+        return result;
+    }();
+
+    SignedDigits digits = RecodeScalar( scalar );
+
+    libff::alt_bn128_G2 result = Lookup( tables[CT_DIGITS - 1], digits, CT_DIGITS - 1 );
+    for ( size_t i = CT_DIGITS - 1; i-- > 0; ) {
+        result = result + Lookup( tables[i], digits, i );
+    }
+
+    ConditionalCopy( result, -result, digits.negate_result );
+
+    return result;
+}
+
+G1FixedBaseTable::G1FixedBaseTable( const libff::alt_bn128_G1& point ) {
+    size_t num_windows = ( libff::alt_bn128_r_bitcount + WINDOW - 1 ) / WINDOW;
+    multiples.reserve( num_windows );
+
+    multiples.push_back( point );
+    for ( size_t i = 1; i < num_windows; ++i ) {
+        libff::alt_bn128_G1 base = multiples.back();
+        for ( size_t j = 0; j < WINDOW; ++j ) {
+            base = base.dbl();
+        }
+        multiples.push_back( base );
+    }
+
+    if ( !point.is_zero() ) {
+        libff::alt_bn128_G1::batch_to_special_all_non_zeros( multiples );
+    }
+}
+
+void G1FixedBaseTable::addTerms( const libff::alt_bn128_Fr& scalar,
+    std::vector< libff::bigint< 1 > >& digits, std::vector< libff::alt_bn128_G1 >& points ) const {
+    libff::bigint< libff::alt_bn128_r_limbs > k = scalar.as_bigint();
+
+    for ( size_t i = 0; i < multiples.size(); ++i ) {
+        mp_limb_t digit = ( k.data[i * WINDOW / GMP_NUMB_BITS] >> ( i * WINDOW % GMP_NUMB_BITS ) ) &
+                          ( ( mp_limb_t( 1 ) << WINDOW ) - 1 );
+        if ( digit != 0 ) {
+            digits.emplace_back( digit );
+            points.push_back( multiples[i] );
+        }
+    }
+}
+
+libff::alt_bn128_G1 G1FixedBaseTable::mul( const libff::alt_bn128_Fr& scalar ) const {
+    std::vector< libff::bigint< 1 > > digits;
+    std::vector< libff::alt_bn128_G1 > points;
+    addTerms( scalar, digits, points );
+
+    return ThresholdUtils::MultiScalarMul( digits, points );
+}
+
+std::array< uint8_t, BLS_FR_BYTES > ThresholdUtils::FrToBytes( const libff::alt_bn128_Fr& elem ) {
+    std::array< uint8_t, BLS_FR_BYTES > bytes;
+    BigintToBytes( elem.as_bigint(), bytes.data() );
+    return bytes;
+}
+
+libff::alt_bn128_Fr ThresholdUtils::FrFromBytes(
+    const std::array< uint8_t, BLS_FR_BYTES >& bytes ) {
+    initCurve();
+
+    return libff::alt_bn128_Fr( BigintFromBytes( bytes.data(), libff::alt_bn128_modulus_r ) );
+}
+
+std::array< uint8_t, BLS_G1_BYTES > ThresholdUtils::G1ToBytes( libff::alt_bn128_G1 elem ) {
+    std::array< uint8_t, BLS_G1_BYTES > bytes{};
+
+    if ( elem.is_zero() ) {
+        bytes[0] = INFINITY_FLAG;
+        return bytes;
+    }
+
+    elem.to_affine_coordinates();
+    BigintToBytes( elem.X.as_bigint(), bytes.data() );
+    if ( !IsLowerRoot( elem.Y ) ) {
+        bytes[0] |= LARGER_ROOT_FLAG;
+    }
+
+    return bytes;
+}
+
+libff::alt_bn128_G1 ThresholdUtils::G1FromBytes(
+    const std::array< uint8_t, BLS_G1_BYTES >& bytes ) {
+    initCurve();
+
+    uint8_t flags = bytes[0] & ( INFINITY_FLAG | LARGER_ROOT_FLAG );
+
+    std::array< uint8_t, BLS_G1_BYTES > x_bytes = bytes;
+    x_bytes[0] &= ~flags;
+
+    if ( flags & INFINITY_FLAG ) {
+        if ( flags != INFINITY_FLAG ||
+             std::any_of( x_bytes.begin(), x_bytes.end(), []( uint8_t b ) { return b != 0; } ) ) {
+            throw IsNotWellFormed( "Wrong encoding of G1 point at infinity" );
+        }
+        return libff::alt_bn128_G1::zero();
+    }
+
+    libff::alt_bn128_Fq x( BigintFromBytes( x_bytes.data(), libff::alt_bn128_modulus_q ) );
+    libff::alt_bn128_Fq y;
+    if ( !Sqrt( x.squared() * x + libff::alt_bn128_coeff_b, y ) ) {
+        throw IsNotWellFormed( "G1 point is not on the curve" );
+    }
+
+    if ( IsLowerRoot( y ) == bool( flags & LARGER_ROOT_FLAG ) ) {
+        y = -y;
+    }
+
+    return libff::alt_bn128_G1( x, y, libff::alt_bn128_Fq::one() );
+}
+
+std::array< uint8_t, BLS_G2_BYTES > ThresholdUtils::G2ToBytes( libff::alt_bn128_G2 elem ) {
+    std::array< uint8_t, BLS_G2_BYTES > bytes{};
+
+    if ( elem.is_zero() ) {
+        bytes[0] = INFINITY_FLAG;
+        return bytes;
+    }
+
+    elem.to_affine_coordinates();
+    BigintToBytes( elem.X.c1.as_bigint(), bytes.data() );
+    BigintToBytes( elem.X.c0.as_bigint(), bytes.data() + 32 );
+    if ( !IsLowerRoot( elem.Y ) ) {
+        bytes[0] |= LARGER_ROOT_FLAG;
+    }
+
+    return bytes;
+}
+
+libff::alt_bn128_G2 ThresholdUtils::G2FromBytes(
+    const std::array< uint8_t, BLS_G2_BYTES >& bytes ) {
+    initCurve();
+
+    uint8_t flags = bytes[0] & ( INFINITY_FLAG | LARGER_ROOT_FLAG );
+
+    std::array< uint8_t, BLS_G2_BYTES > x_bytes = bytes;
+    x_bytes[0] &= ~flags;
+
+    if ( flags & INFINITY_FLAG ) {
+        if ( flags != INFINITY_FLAG ||
+             std::any_of( x_bytes.begin(), x_bytes.end(), []( uint8_t b ) { return b != 0; } ) ) {
+            throw IsNotWellFormed( "Wrong encoding of G2 point at infinity" );
+        }
+        return libff::alt_bn128_G2::zero();
+    }
+
+    libff::alt_bn128_Fq2 x(
+        libff::alt_bn128_Fq( BigintFromBytes( x_bytes.data() + 32, libff::alt_bn128_modulus_q ) ),
+        libff::alt_bn128_Fq( BigintFromBytes( x_bytes.data(), libff::alt_bn128_modulus_q ) ) );
+    libff::alt_bn128_Fq2 y;
+    if ( !Sqrt( x.squared() * x + libff::alt_bn128_twist_coeff_b, y ) ) {
+        throw IsNotWellFormed( "G2 point is not on the curve" );
+    }
+
+    if ( IsLowerRoot( y ) == bool( flags & LARGER_ROOT_FLAG ) ) {
+        y = -y;
+    }
+
+    return libff::alt_bn128_G2( x, y, libff::alt_bn128_Fq2::one() );
+}
+
+std::array< uint8_t, BLS_HINT_BYTES > ThresholdUtils::HintToBytes( const std::string& hint ) {
+    std::pair< libff::alt_bn128_Fq, libff::alt_bn128_Fq > y_shift_x = ParseHint( hint );
+
+    libff::bigint< libff::alt_bn128_q_limbs > counter = y_shift_x.second.as_bigint();
+    if ( counter.num_bits() > 64 ) {
+        throw IncorrectInput( "Hint counter does not fit into 64 bits" );
+    }
+
+    std::array< uint8_t, BLS_HINT_BYTES > bytes;
+    BigintToBytes( y_shift_x.first.as_bigint(), bytes.data() );
+    for ( size_t i = 0; i < 8; ++i ) {
+        bytes[BLS_HINT_BYTES - 1 - i] = BigintByte( counter, i );
+    }
+
+    return bytes;
+}
+
+std::string ThresholdUtils::HintFromBytes( const std::array< uint8_t, BLS_HINT_BYTES >& bytes ) {
+    initCurve();
+
+    libff::alt_bn128_Fq y( BigintFromBytes( bytes.data(), libff::alt_bn128_modulus_q ) );
+
+    uint64_t counter = 0;
+    for ( size_t i = 32; i < BLS_HINT_BYTES; ++i ) {
+        counter = ( counter << 8 ) | bytes[i];
+    }
+
+    return fieldElementToString( y ) + ":" + std::to_string( counter );
+}
+
+const uint8_t* ThresholdUtils::CheckBinaryFormat(
+    const std::vector< uint8_t >& bytes, size_t size ) {
+    if ( bytes.size() != size + 1 ) {
+        throw IncorrectInput( "Wrong size of binary encoding:" + std::to_string( bytes.size() ) );
+    }
+
+    if ( bytes[0] != BLS_BINARY_FORMAT_VERSION ) {
+        throw IncorrectInput(
+            "Unsupported binary format version:" + std::to_string( int( bytes[0] ) ) );
+    }
+
+    return bytes.data() + 1;
+}
+
 std::vector< std::string > ThresholdUtils::G2ToString( libff::alt_bn128_G2 elem, int base ) {
     std::vector< std::string > pkey_str_vect;
 
@@ -141,43 +731,169 @@ std::vector< libff::alt_bn128_Fr > ThresholdUtils::LagrangeCoeffs(
         throw IncorrectInput( "not enough participants in the threshold group" );
     }
 
-    std::vector< libff::alt_bn128_Fr > res( t );
+    std::vector< size_t > sorted_idx( idx.begin(), idx.begin() + t );
+    std::sort( sorted_idx.begin(), sorted_idx.end() );
+    if ( std::adjacent_find( sorted_idx.begin(), sorted_idx.end() ) != sorted_idx.end() ) {
+        throw IncorrectInput( "during the interpolation, have same indexes in list of indexes" );
+    }
+    if ( !sorted_idx.empty() && sorted_idx.front() == 0 ) {
+        throw IncorrectInput( "during the interpolation, index is equal to zero" );
+    }
+
+    std::vector< libff::alt_bn128_Fr > points( t );
+    for ( size_t i = 0; i < t; ++i ) {
+        points[i] = libff::alt_bn128_Fr( idx[i] );
+    }
 
     libff::alt_bn128_Fr w = libff::alt_bn128_Fr::one();
 
     for ( size_t i = 0; i < t; ++i ) {
-        w *= libff::alt_bn128_Fr( idx[i] );
+        w *= points[i];
     }
 
+    // res[i] = w / ( idx[i] * prod( idx[j] - idx[i] ) ), all denominators are inverted at once
+    std::vector< libff::alt_bn128_Fr > res( t );
     for ( size_t i = 0; i < t; ++i ) {
-        libff::alt_bn128_Fr v = libff::alt_bn128_Fr( idx[i] );
-
+        res[i] = points[i];
         for ( size_t j = 0; j < t; ++j ) {
             if ( j != i ) {
-                if ( libff::alt_bn128_Fr( idx[i] ) == libff::alt_bn128_Fr( idx[j] ) ) {
-                    throw IncorrectInput(
-                        "during the interpolation, have same indexes in list of indexes" );
-                }
+                res[i] *= ( points[j] - points[i] );  // calculating Lagrange coefficients
+            }
+        }
+    }
+
+    BatchInvert( res );
+
+    for ( size_t i = 0; i < t; ++i ) {
+        res[i] *= w;
+    }
+
+    return res;
+}
+
+void ThresholdUtils::BatchInvert( std::vector< libff::alt_bn128_Fr >& elements ) {
+    if ( elements.empty() ) {
+        return;
+    }
+
+    // Montgomery's trick: one inversion of the product of all elements
+    std::vector< libff::alt_bn128_Fr > prefix( elements.size() );
+    libff::alt_bn128_Fr product = libff::alt_bn128_Fr::one();
+    for ( size_t i = 0; i < elements.size(); ++i ) {
+        if ( elements[i].is_zero() ) {
+            throw IncorrectInput( "can not invert zero" );
+        }
+        prefix[i] = product;
+        product *= elements[i];
+    }
+
+    libff::alt_bn128_Fr inverse = product.invert();
+    for ( size_t i = elements.size(); i-- > 0; ) {
+        libff::alt_bn128_Fr element = elements[i];
+        elements[i] = inverse * prefix[i];
+        inverse *= element;
+    }
+}
+
+LagrangeCoeffsCache::LagrangeCoeffsCache( size_t _capacity )
+    : capacity( std::max< size_t >( _capacity, 1 ) ), hits( 0 ), misses( 0 ) {}
 
-                v *= ( libff::alt_bn128_Fr( idx[j] ) -
-                       libff::alt_bn128_Fr( idx[i] ) );  // calculating Lagrange coefficients
+std::vector< libff::alt_bn128_Fr > LagrangeCoeffsCache::get(
+    const std::vector< size_t >& idx, size_t t ) {
+    if ( idx.size() < t ) {
+        throw ThresholdUtils::IncorrectInput( "not enough participants in the threshold group" );
+    }
+
+    std::vector< size_t > sorted_idx( idx.begin(), idx.begin() + t );
+    std::sort( sorted_idx.begin(), sorted_idx.end() );
+
+    // a hit would skip the checks of LagrangeCoeffs, so the indexes are checked here
+    if ( std::adjacent_find( sorted_idx.begin(), sorted_idx.end() ) != sorted_idx.end() ) {
+        throw ThresholdUtils::IncorrectInput(
+            "during the interpolation, have same indexes in list of indexes" );
+    }
+    if ( !sorted_idx.empty() && sorted_idx.front() == 0 ) {
+        throw ThresholdUtils::IncorrectInput( "during the interpolation, index is equal to zero" );
+    }
+
+    if ( sorted_idx.empty() || sorted_idx.back() > LAGRANGE_COEFFS_CACHE_MAX_INDEX ) {
+        return ThresholdUtils::LagrangeCoeffs( idx, t );
+    }
+
+    // the signer set as a bitmap followed by t
+    std::vector< uint64_t > signers( sorted_idx.back() / 64 + 2 );
+    for ( size_t index : sorted_idx ) {
+        signers[index / 64] |= uint64_t( 1 ) << ( index % 64 );
+    }
+    signers.back() = t;
+
+    std::vector< libff::alt_bn128_Fr > sorted_coeffs;
+
+    std::unique_lock< std::mutex > lock( mutex );
+    auto it = index.find( signers );
+    if ( it != index.end() ) {
+        entries.splice( entries.begin(), entries, it->second );
+        ++hits;
+        sorted_coeffs = it->second->second;
+        lock.unlock();
+    } else {
+        lock.unlock();
+        ++misses;
+
+        // the coefficients are computed without holding the lock
+        sorted_coeffs = ThresholdUtils::LagrangeCoeffs( sorted_idx, t );
+
+        lock.lock();
+        if ( index.count( signers ) == 0 ) {
+            entries.emplace_front( signers, sorted_coeffs );
+            index[signers] = entries.begin();
+
+            if ( entries.size() > capacity ) {
+                index.erase( entries.back().first );
+                entries.pop_back();
             }
         }
+        lock.unlock();
+    }
 
-        res[i] = w * v.invert();
+    std::vector< libff::alt_bn128_Fr > res( t );
+    for ( size_t i = 0; i < t; ++i ) {
+        res[i] = sorted_coeffs[std::lower_bound( sorted_idx.begin(), sorted_idx.end(), idx[i] ) -
+                               sorted_idx.begin()];
     }
 
     return res;
 }
 
+uint64_t LagrangeCoeffsCache::getHits() const {
+    return hits;
+}
+
+uint64_t LagrangeCoeffsCache::getMisses() const {
+    return misses;
+}
+
+LagrangeCoeffsCache& LagrangeCoeffsCache::getInstance() {
+    static LagrangeCoeffsCache instance( LAGRANGE_COEFFS_CACHE_SIZE );
+    return instance;
+}
+
 libff::alt_bn128_Fq ThresholdUtils::HashToFq(
     std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr ) {
+    if ( !hash_byte_arr ) {
+        throw IncorrectInput( "hash is null" );
+    }
+
+    return HashToFq( *hash_byte_arr );
+}
+
+libff::alt_bn128_Fq ThresholdUtils::HashToFq( const std::array< uint8_t, 32 >& hash_byte_arr ) {
     libff::bigint< libff::alt_bn128_q_limbs > from_hex;
 
-    std::vector< uint8_t > hex( 64 );
+    std::array< uint8_t, 64 > hex;
     for ( size_t i = 0; i < 32; ++i ) {
-        hex[2 * i] = static_cast< int >( hash_byte_arr->at( i ) ) / 16;
-        hex[2 * i + 1] = static_cast< int >( hash_byte_arr->at( i ) ) % 16;
+        hex[2 * i] = static_cast< int >( hash_byte_arr[i] ) / 16;
+        hex[2 * i + 1] = static_cast< int >( hash_byte_arr[i] ) % 16;
     }
     mpn_set_str( from_hex.data, hex.data(), 64, 16 );
 
@@ -186,49 +902,102 @@ libff::alt_bn128_Fq ThresholdUtils::HashToFq(
     return ret_val;
 }
 
-libff::alt_bn128_G1 ThresholdUtils::HashtoG1(
+std::pair< libff::alt_bn128_G1, uint64_t > ThresholdUtils::HashtoG1WithCounter(
     std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr ) {
-    libff::alt_bn128_Fq x1( HashToFq( hash_byte_arr ) );
+    if ( !hash_byte_arr ) {
+        throw IncorrectInput( "hash is null" );
+    }
+
+    return HashtoG1WithCounter( *hash_byte_arr );
+}
 
-    libff::alt_bn128_G1 result;
+std::pair< libff::alt_bn128_G1, uint64_t > ThresholdUtils::HashtoG1WithCounter(
+    const std::array< uint8_t, 32 >& hash_byte_arr ) {
+    initCurve();
+
+    // one exponentiation per candidate x is enough, see Sqrt
+    libff::alt_bn128_Fq x = HashToFq( hash_byte_arr );
+    uint64_t counter = 0;
 
     while ( true ) {
-        libff::alt_bn128_Fq y1_sqr = x1 ^ 3;
-        y1_sqr = y1_sqr + libff::alt_bn128_coeff_b;
+        libff::alt_bn128_Fq y_sqr = x.squared() * x + libff::alt_bn128_coeff_b;
+        libff::alt_bn128_Fq y;
 
-        libff::alt_bn128_Fq euler = y1_sqr ^ libff::alt_bn128_Fq::euler;
+        if ( Sqrt( y_sqr, y ) ) {
+            // the larger one of y and -y is taken
+            if ( IsLowerRoot( y ) ) {
+                y = -y;
+            }
 
-        if ( euler == libff::alt_bn128_Fq::one() ||
-             euler == libff::alt_bn128_Fq::zero() ) {  // if y1_sqr is a square
-            result.X = x1;
-            libff::alt_bn128_Fq temp_y = y1_sqr.sqrt();
+            return { libff::alt_bn128_G1( x, y, libff::alt_bn128_Fq::one() ), counter };
+        }
 
-            mpz_t pos_y;
-            mpz_init( pos_y );
+        x = x + libff::alt_bn128_Fq::one();
+        ++counter;
+    }
+}
 
-            temp_y.as_bigint().to_mpz( pos_y );
+libff::alt_bn128_G1 ThresholdUtils::HashtoG1(
+    std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr ) {
+    return HashToG1Cache::getInstance().get( hash_byte_arr ).first;
+}
 
-            mpz_t neg_y;
-            mpz_init( neg_y );
+libff::alt_bn128_G1 ThresholdUtils::HashtoG1( const std::array< uint8_t, 32 >& hash_byte_arr ) {
+    return HashtoG1WithCounter( hash_byte_arr ).first;
+}
 
-            ( -temp_y ).as_bigint().to_mpz( neg_y );
+HashToG1Cache::HashToG1Cache( size_t capacity )
+    : shardCapacity( std::max< size_t >( capacity / NUM_SHARDS, 1 ) ), hits( 0 ), misses( 0 ) {}
 
-            if ( mpz_cmp( pos_y, neg_y ) < 0 ) {
-                temp_y = -temp_y;
-            }
+std::pair< libff::alt_bn128_G1, uint64_t > HashToG1Cache::get(
+    std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr ) {
+    if ( !hash_byte_arr ) {
+        throw ThresholdUtils::IncorrectInput( "hash is null" );
+    }
 
-            mpz_clear( pos_y );
-            mpz_clear( neg_y );
+    Shard& shard = shards[hash_byte_arr->at( 0 ) % NUM_SHARDS];
 
-            result.Y = temp_y;
-            break;
-        } else {
-            x1 = x1 + 1;
+    {
+        std::lock_guard< std::mutex > lock( shard.mutex );
+        auto it = shard.index.find( *hash_byte_arr );
+        if ( it != shard.index.end() ) {
+            shard.entries.splice( shard.entries.begin(), shard.entries, it->second );
+            ++hits;
+            return it->second->second;
         }
     }
-    result.Z = libff::alt_bn128_Fq::one();
 
-    return result;
+    ++misses;
+
+    // the point is computed without holding the lock
+    std::pair< libff::alt_bn128_G1, uint64_t > point =
+        ThresholdUtils::HashtoG1WithCounter( hash_byte_arr );
+
+    std::lock_guard< std::mutex > lock( shard.mutex );
+    if ( shard.index.count( *hash_byte_arr ) == 0 ) {
+        shard.entries.emplace_front( *hash_byte_arr, point );
+        shard.index[*hash_byte_arr] = shard.entries.begin();
+
+        if ( shard.entries.size() > shardCapacity ) {
+            shard.index.erase( shard.entries.back().first );
+            shard.entries.pop_back();
+        }
+    }
+
+    return point;
+}
+
+uint64_t HashToG1Cache::getHits() const {
+    return hits;
+}
+
+uint64_t HashToG1Cache::getMisses() const {
+    return misses;
+}
+
+HashToG1Cache& HashToG1Cache::getInstance() {
+    static HashToG1Cache instance( HASH_TO_G1_CACHE_SIZE );
+    return instance;
 }
 
 libff::alt_bn128_G1 ThresholdUtils::HashtoG1( const std::string& message ) {
@@ -346,15 +1115,7 @@ std::shared_ptr< std::vector< std::string > > ThresholdUtils::SplitString(
 }
 
 void ThresholdUtils::initAES() {
-    static int init = 0;
-    if ( init == 0 ) {
-        // initialize openssl ciphers
-        OpenSSL_add_all_ciphers();
-
-        // initialize random number generator (for IVs)
-        RAND_load_file( "/dev/urandom", 32 );
-        ++init;
-    }
+    LibBLSContext::get();
 }
 
 std::vector< uint8_t > ThresholdUtils::aesEncrypt(
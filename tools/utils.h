@@ -24,16 +24,52 @@
 #ifndef LIBBLS_UTILS_H
 #define LIBBLS_UTILS_H
 
+#include <algorithm>
 #include <array>
 #include <atomic>
+#include <exception>
+#include <limits>
+#include <list>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
 
+#ifndef EMSCRIPTEN
+#include <thread>
+#endif
+
 #include <libff/algebra/curves/alt_bn128/alt_bn128_pp.hpp>
 
 static constexpr size_t BLS_MAX_COMPONENT_LEN = 77;
 
+// number of message hashes whose G1 points are kept in HashToG1Cache::getInstance()
+static constexpr size_t HASH_TO_G1_CACHE_SIZE = 1024;
+
+// number of signer sets whose Lagrange coefficients are kept in LagrangeCoeffsCache::getInstance()
+static constexpr size_t LAGRANGE_COEFFS_CACHE_SIZE = 64;
+
+// signer sets with larger indexes are not cached
+static constexpr size_t LAGRANGE_COEFFS_CACHE_MAX_INDEX = 4096;
+
+// first byte of binary encodings of keys, shares and signatures
+static constexpr uint8_t BLS_BINARY_FORMAT_VERSION = 1;
+
+// sizes of binary encodings: big endian field elements, compressed points with flag bits in
+// the highest bits of the first byte, the hint is the y of the hash point and a 64 bit counter
+static constexpr size_t BLS_FR_BYTES = 32;
+static constexpr size_t BLS_G1_BYTES = 32;
+static constexpr size_t BLS_G2_BYTES = 64;
+static constexpr size_t BLS_HINT_BYTES = 40;
+
+// cheap work such as field multiplications is split between threads only if every thread gets
+// at least this many of them, starting a thread costs about as much
+static constexpr size_t PARALLEL_MIN_FR_MULS = 4096;
+
+// random weights used in batch verification are 128 bit long
+static constexpr mp_size_t BATCH_WEIGHT_LIMBS = 128 / GMP_NUMB_BITS;
+
 namespace libBLS {
 
 class ThresholdUtils {
@@ -72,6 +108,7 @@ public:
 
     static std::atomic< bool > is_initialized;
 
+    // both only make sure LibBLSContext is built, which takes no lock once it is
     static void initCurve();
 
     static void initAES();
@@ -81,12 +118,26 @@ public:
     static std::vector< libff::alt_bn128_Fr > LagrangeCoeffs(
         const std::vector< size_t >& idx, size_t t );
 
+    static void BatchInvert( std::vector< libff::alt_bn128_Fr >& elements );
+
     static libff::alt_bn128_Fq HashToFq(
         std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr );
 
+    static libff::alt_bn128_Fq HashToFq( const std::array< uint8_t, 32 >& hash_byte_arr );
+
+    static std::pair< libff::alt_bn128_G1, uint64_t > HashtoG1WithCounter(
+        std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr );
+
+    // does not go through HashToG1Cache and does not allocate
+    static std::pair< libff::alt_bn128_G1, uint64_t > HashtoG1WithCounter(
+        const std::array< uint8_t, 32 >& hash_byte_arr );
+
     static libff::alt_bn128_G1 HashtoG1(
         std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr );
 
+    // does not go through HashToG1Cache
+    static libff::alt_bn128_G1 HashtoG1( const std::array< uint8_t, 32 >& hash_byte_arr );
+
     static libff::alt_bn128_G1 HashtoG1( const std::string& message );
 
     static std::vector< uint8_t > aesEncrypt( const std::string& message, const std::string& key );
@@ -117,12 +168,170 @@ public:
 
     static libff::alt_bn128_G1 stringToG1( const std::string& str );
 
+    static std::array< uint8_t, BLS_FR_BYTES > FrToBytes( const libff::alt_bn128_Fr& elem );
+
+    static libff::alt_bn128_Fr FrFromBytes( const std::array< uint8_t, BLS_FR_BYTES >& bytes );
+
+    static std::array< uint8_t, BLS_G1_BYTES > G1ToBytes( libff::alt_bn128_G1 elem );
+
+    static libff::alt_bn128_G1 G1FromBytes( const std::array< uint8_t, BLS_G1_BYTES >& bytes );
+
+    static std::array< uint8_t, BLS_G2_BYTES > G2ToBytes( libff::alt_bn128_G2 elem );
+
+    static libff::alt_bn128_G2 G2FromBytes( const std::array< uint8_t, BLS_G2_BYTES >& bytes );
+
+    static std::array< uint8_t, BLS_HINT_BYTES > HintToBytes( const std::string& hint );
+
+    static std::string HintFromBytes( const std::array< uint8_t, BLS_HINT_BYTES >& bytes );
+
+    // checks size and version of a binary encoding, returns pointer to the data after version
+    static const uint8_t* CheckBinaryFormat( const std::vector< uint8_t >& bytes, size_t size );
+
     static std::string convertHexToDec( const std::string& hex_str );
 
     static bool checkHex( const std::string& hex );
 
     template < class T >
     static bool ValidateKey( const T& point );
+
+    static const libff::alt_bn128_ate_G2_precomp& G2GeneratorPrecomp();
+
+    static bool CheckPairing( const libff::alt_bn128_G1& signature, const libff::alt_bn128_G1& hash,
+        const libff::alt_bn128_G2& public_key );
+
+    static bool CheckPairing( const libff::alt_bn128_G1& signature, const libff::alt_bn128_G1& hash,
+        const libff::alt_bn128_ate_G2_precomp& public_key_precomp );
+
+    static libff::alt_bn128_G1 ConstantTimeMul(
+        const libff::alt_bn128_Fr& scalar, const libff::alt_bn128_G1& point );
+
+    static libff::alt_bn128_G2 mulGenerator( const libff::alt_bn128_Fr& scalar );
+
+    static libff::alt_bn128_Fq12 MultiMillerLoop( const std::vector< libff::alt_bn128_G1 >& points,
+        const std::vector< const libff::alt_bn128_ate_G2_precomp* >& precomps );
+
+    template < class T, mp_size_t N >
+    static T MultiScalarMul(
+        const std::vector< libff::bigint< N > >& scalars, const std::vector< T >& points );
+
+    template < class T >
+    static T MultiScalarMul(
+        const std::vector< libff::alt_bn128_Fr >& scalars, const std::vector< T >& points );
+
+    static std::vector< libff::bigint< BATCH_WEIGHT_LIMBS > > GenerateBatchWeights( size_t count );
+
+    template < class CheckRange >
+    static void BisectFailedBatch(
+        size_t begin, size_t end, const CheckRange& check, std::vector< size_t >& failed );
+
+    template < class Func >
+    static void ParallelFor( size_t count, const Func& func, size_t grain = 1 );
+};
+
+// 2^( 8 * i ) * point for every byte i of a scalar in affine coordinates, products of many
+// tables with public scalars are then computed as one multi-scalar multiplication of 8 bit
+// scalars, which takes no doublings and shares buckets between all bytes of all points
+class G1FixedBaseTable {
+public:
+    explicit G1FixedBaseTable( const libff::alt_bn128_G1& point );
+
+    // appends the bytes of scalar and their points
+    void addTerms( const libff::alt_bn128_Fr& scalar, std::vector< libff::bigint< 1 > >& digits,
+        std::vector< libff::alt_bn128_G1 >& points ) const;
+
+    libff::alt_bn128_G1 mul( const libff::alt_bn128_Fr& scalar ) const;
+
+private:
+    static constexpr size_t WINDOW = 8;
+
+    std::vector< libff::alt_bn128_G1 > multiples;
+};
+
+// thread safe LRU cache of LagrangeCoeffs results, keyed by the set of the first t signers
+class LagrangeCoeffsCache {
+public:
+    explicit LagrangeCoeffsCache( size_t _capacity );
+
+    std::vector< libff::alt_bn128_Fr > get( const std::vector< size_t >& idx, size_t t );
+
+    uint64_t getHits() const;
+
+    uint64_t getMisses() const;
+
+    static LagrangeCoeffsCache& getInstance();
+
+private:
+    // coefficients are stored in the ascending order of signer indexes
+    typedef std::pair< std::vector< uint64_t >, std::vector< libff::alt_bn128_Fr > > Entry;
+
+    size_t capacity;
+
+    std::mutex mutex;
+
+    std::list< Entry > entries;  // most recently used first
+
+    std::map< std::vector< uint64_t >, std::list< Entry >::iterator > index;
+
+    std::atomic< uint64_t > hits;
+
+    std::atomic< uint64_t > misses;
+};
+
+// thread safe LRU cache of HashtoG1WithCounter results, keyed by the message hash
+class HashToG1Cache {
+public:
+    explicit HashToG1Cache( size_t capacity );
+
+    std::pair< libff::alt_bn128_G1, uint64_t > get(
+        std::shared_ptr< std::array< uint8_t, 32 > > hash_byte_arr );
+
+    uint64_t getHits() const;
+
+    uint64_t getMisses() const;
+
+    static HashToG1Cache& getInstance();
+
+private:
+    typedef std::pair< std::array< uint8_t, 32 >, std::pair< libff::alt_bn128_G1, uint64_t > >
+        Entry;
+
+    // hashes are split between shards by their first byte, so that threads hashing different
+    // messages rarely wait for each other
+    struct Shard {
+        std::mutex mutex;
+        std::list< Entry > entries;  // most recently used first
+        std::map< std::array< uint8_t, 32 >, std::list< Entry >::iterator > index;
+    };
+
+    static constexpr size_t NUM_SHARDS = 16;
+
+    size_t shardCapacity;
+
+    std::array< Shard, NUM_SHARDS > shards;
+
+    std::atomic< uint64_t > hits;
+
+    std::atomic< uint64_t > misses;
+};
+
+// process-wide state of the library: libff curve parameters, OpenSSL ciphers and precomputed
+// values that do not depend on keys, built once on first use and read only afterwards, so
+// threads never wait for each other to use it
+class LibBLSContext {
+public:
+    static const LibBLSContext& get();
+
+    const libff::alt_bn128_ate_G2_precomp& getG2GeneratorPrecomp() const;
+
+    const libff::bigint< libff::alt_bn128_q_limbs >& getSqrtPower() const;
+
+private:
+    LibBLSContext();
+
+    libff::alt_bn128_ate_G2_precomp g2GeneratorPrecomp;
+
+    // ( q + 1 ) / 4, a square root of a in Fq is a^sqrtPower
+    libff::bigint< libff::alt_bn128_q_limbs > sqrtPower;
 };
 
 template < class T >
@@ -147,6 +356,164 @@ bool ThresholdUtils::ValidateKey( const T& point ) {
     return point.is_well_formed() && T::order() * point == T::zero();
 }
 
+// G2 has a cheaper membership test through the untwist-Frobenius-twist endomorphism
+template <>
+bool ThresholdUtils::ValidateKey( const libff::alt_bn128_G2& point );
+
+// sum( scalars[i] * points[i] ) with the bucket method of Pippenger, every window of the scalars
+// costs one addition per point plus two per bucket instead of a full scalar multiplication
+// per point, points in affine coordinates are added with cheaper mixed additions
+template < class T, mp_size_t N >
+T ThresholdUtils::MultiScalarMul(
+    const std::vector< libff::bigint< N > >& scalars, const std::vector< T >& points ) {
+    if ( scalars.size() != points.size() ) {
+        throw IncorrectInput( "Number of scalars and points do not match" );
+    }
+
+    size_t num_bits = 0;
+    for ( const auto& scalar : scalars ) {
+        num_bits = std::max( num_bits, scalar.num_bits() );
+    }
+
+    // window width with the lowest number of additions for this number of points
+    size_t window = 1;
+    size_t best_cost = std::numeric_limits< size_t >::max();
+    for ( size_t c = 1; c <= 16; ++c ) {
+        size_t cost = ( ( num_bits + c - 1 ) / c ) * ( points.size() + ( size_t( 2 ) << c ) );
+        if ( cost < best_cost ) {
+            best_cost = cost;
+            window = c;
+        }
+    }
+
+    T result = T::zero();
+    std::vector< T > buckets( ( size_t( 1 ) << window ) - 1 );
+
+    for ( size_t offset = ( num_bits + window - 1 ) / window * window; offset > 0; ) {
+        offset -= window;
+
+        for ( size_t j = 0; j < window; ++j ) {
+            result = result.dbl();
+        }
+
+        std::fill( buckets.begin(), buckets.end(), T::zero() );
+
+        for ( size_t i = 0; i < points.size(); ++i ) {
+            size_t digit = 0;
+            for ( size_t j = 0; j < window && offset + j < num_bits; ++j ) {
+                digit |= size_t( scalars[i].test_bit( offset + j ) ) << j;
+            }
+
+            if ( digit != 0 ) {
+                T& bucket = buckets[digit - 1];
+                bucket = points[i].is_special() ? bucket.mixed_add( points[i] ) :
+                                                  bucket + points[i];
+            }
+        }
+
+        // sum( ( k + 1 ) * buckets[k] ) as a sum of running sums
+        T running_sum = T::zero();
+        T window_sum = T::zero();
+        for ( size_t k = buckets.size(); k-- > 0; ) {
+            running_sum = running_sum + buckets[k];
+            window_sum = window_sum + running_sum;
+        }
+
+        result = result + window_sum;
+    }
+
+    return result;
+}
+
+template < class T >
+T ThresholdUtils::MultiScalarMul(
+    const std::vector< libff::alt_bn128_Fr >& scalars, const std::vector< T >& points ) {
+    std::vector< libff::bigint< libff::alt_bn128_r_limbs > > bigints;
+    bigints.reserve( scalars.size() );
+    for ( const auto& scalar : scalars ) {
+        bigints.push_back( scalar.as_bigint() );
+    }
+
+    return MultiScalarMul( bigints, points );
+}
+
+// [begin, end) is known to fail the check, find every single element that fails it
+template < class CheckRange >
+void ThresholdUtils::BisectFailedBatch(
+    size_t begin, size_t end, const CheckRange& check, std::vector< size_t >& failed ) {
+    if ( end - begin == 1 ) {
+        failed.push_back( begin );
+        return;
+    }
+
+    size_t middle = begin + ( end - begin ) / 2;
+
+    if ( check( begin, middle ) ) {
+        // the failure is in the second half for sure
+        BisectFailedBatch( middle, end, check, failed );
+        return;
+    }
+
+    BisectFailedBatch( begin, middle, check, failed );
+
+    if ( !check( middle, end ) ) {
+        BisectFailedBatch( middle, end, check, failed );
+    }
+}
+
+// splits [0, count) into contiguous chunks of at least grain elements and calls
+// func( begin, end ) for each of them on its own thread, the first exception thrown by any chunk
+// is rethrown to the caller
+template < class Func >
+void ThresholdUtils::ParallelFor( size_t count, const Func& func, size_t grain ) {
+#ifdef EMSCRIPTEN
+    if ( count > 0 ) {
+        func( size_t( 0 ), count );
+    }
+#else
+    size_t num_threads = std::max( std::thread::hardware_concurrency(), 1u );
+    num_threads = std::min( num_threads, count / std::max( grain, size_t( 1 ) ) );
+
+    if ( num_threads <= 1 ) {
+        if ( count > 0 ) {
+            func( size_t( 0 ), count );
+        }
+        return;
+    }
+
+    size_t chunk_size = ( count + num_threads - 1 ) / num_threads;
+
+    std::vector< std::exception_ptr > errors( num_threads );
+    std::vector< std::thread > threads;
+    threads.reserve( num_threads - 1 );
+
+    auto run_chunk = [&]( size_t chunk ) {
+        try {
+            size_t begin = chunk * chunk_size;
+            func( begin, std::min( begin + chunk_size, count ) );
+        } catch ( ... ) {
+            errors[chunk] = std::current_exception();
+        }
+    };
+
+    for ( size_t chunk = 1; chunk < num_threads && chunk * chunk_size < count; ++chunk ) {
+        threads.emplace_back( run_chunk, chunk );
+    }
+
+    run_chunk( 0 );
+
+    for ( auto& thread : threads ) {
+        thread.join();
+    }
+
+    for ( auto& error : errors ) {
+        if ( error ) {
+            std::rethrow_exception( error );
+        }
+    }
+#endif
+}
+
 }  // namespace libBLS
 
 #endif  // LIBBLS_UTILS_H